@@ -0,0 +1,157 @@
+/*
+ * This file is part of the CMaNGOS Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef MANGOS_FLAT_MULTIMAP_H
+#define MANGOS_FLAT_MULTIMAP_H
+
+#include "Platform/Define.h"
+#include <vector>
+#include <algorithm>
+#include <functional>
+#include <utility>
+#include <cassert>
+
+/**
+ * Multimap for static lookup data, kept as one sorted array.
+ *
+ * Offers the read part of the std::multimap interface used by the lookup
+ * tables, so Bounds typedefs and range loops stay unchanged. Values with
+ * equal keys keep their insertion order, like std::multimap.
+ *
+ * The content is only written by its loader: clear() starts loading,
+ * insert() appends and Freeze() sorts and trims the array. Lookups are
+ * not allowed while loading, after Freeze() they never write and are safe
+ * from any thread. Tables changed at runtime must stay std::multimap,
+ * values and iterators here are not stable across inserts.
+ */
+template<typename Key, typename T, typename Compare = std::less<Key> >
+class FlatMultiMap
+{
+    public:
+        typedef Key key_type;
+        typedef T mapped_type;
+        typedef std::pair<Key, T> value_type;
+        typedef std::vector<value_type> Storage;
+        typedef typename Storage::size_type size_type;
+        typedef typename Storage::const_iterator const_iterator;
+        typedef const_iterator iterator;                    // content is read only after loading
+
+        /// Freezes the map when the loader leaves its scope, early returns included
+        class FreezeGuard
+        {
+            public:
+                explicit FreezeGuard(FlatMultiMap& map) : m_map(map) {}
+                ~FreezeGuard() { m_map.Freeze(); }
+
+            private:
+                FreezeGuard(FreezeGuard const&);
+                FreezeGuard& operator=(FreezeGuard const&);
+
+                FlatMultiMap& m_map;
+        };
+
+        FlatMultiMap() : m_frozen(true) {}
+
+        const_iterator begin() const { assert(m_frozen && "FlatMultiMap used while loading"); return m_data.begin(); }
+        const_iterator end() const { return m_data.end(); }
+
+        size_type size() const { return m_data.size(); }
+        bool empty() const { return m_data.empty(); }
+
+        /// drops the content and starts loading, see Freeze()
+        void clear()
+        {
+            Storage().swap(m_data);
+            m_frozen = false;
+        }
+
+        void insert(value_type const& value)
+        {
+            assert(!m_frozen && "FlatMultiMap insert after loading");
+            m_data.push_back(value);
+        }
+
+        const_iterator lower_bound(key_type const& key) const
+        {
+            assert(m_frozen && "FlatMultiMap used while loading");
+            return std::lower_bound(m_data.begin(), m_data.end(), key, ValueCompare());
+        }
+
+        const_iterator upper_bound(key_type const& key) const
+        {
+            assert(m_frozen && "FlatMultiMap used while loading");
+            return std::upper_bound(m_data.begin(), m_data.end(), key, ValueCompare());
+        }
+
+        std::pair<const_iterator, const_iterator> equal_range(key_type const& key) const
+        {
+            assert(m_frozen && "FlatMultiMap used while loading");
+            return std::equal_range(m_data.begin(), m_data.end(), key, ValueCompare());
+        }
+
+        const_iterator find(key_type const& key) const
+        {
+            const_iterator itr = lower_bound(key);
+            return itr != m_data.end() && !Compare()(key, itr->first) ? itr : m_data.end();
+        }
+
+        size_type count(key_type const& key) const
+        {
+            std::pair<const_iterator, const_iterator> bounds = equal_range(key);
+            return bounds.second - bounds.first;
+        }
+
+        /// sorts and trims the storage at the end of loading
+        void Freeze()
+        {
+            if (m_frozen)
+                return;
+
+            std::stable_sort(m_data.begin(), m_data.end(), ValueCompare());
+            Storage(m_data).swap(m_data);
+            m_frozen = true;
+        }
+
+        bool IsFrozen() const { return m_frozen; }
+
+        /// bytes held by the array
+        size_t GetMemoryUsage() const { return m_data.capacity() * sizeof(value_type); }
+        /// bytes a std::multimap with the same content would hold: value plus color and three links per node
+        size_t GetTreeMemoryEstimate() const { return m_data.size() * (sizeof(value_type) + 4 * sizeof(void*)); }
+
+    private:
+        struct ValueCompare
+        {
+            bool operator()(value_type const& a, value_type const& b) const { return Compare()(a.first, b.first); }
+            bool operator()(value_type const& a, key_type const& b) const { return Compare()(a.first, b); }
+            bool operator()(key_type const& a, value_type const& b) const { return Compare()(a, b.first); }
+        };
+
+        Storage m_data;
+        bool m_frozen;                                      ///< Loading done, lookups allowed
+};
+
+/// Adds the memory of a lookup table and the estimate for the same data as tree
+template<typename Table>
+inline void AddLookupTableMemory(Table const& table, size_t& flat, size_t& tree)
+{
+    flat += table.GetMemoryUsage();
+    tree += table.GetTreeMemoryEstimate();
+}
+
+#endif
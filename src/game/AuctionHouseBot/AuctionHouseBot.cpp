@@ -189,6 +189,7 @@ class AuctionBotBuyer : public AuctionBotAgent
         void        PlaceBidToEntry(AuctionEntry* auction, uint32 bidPrice);
         void        BuyEntry(AuctionEntry* auction);
         void        PrepareListOfEntry(AHB_Buyer_Config& config);
+        void        FillSameItemInfo(AuctionHouseObject const* auctionHouse, uint32 itemEntry, BuyerItemInfo& buyerItem);
         uint32      GetBuyableEntry(AHB_Buyer_Config& config);
 };
 
@@ -531,67 +532,61 @@ void AuctionBotBuyer::LoadConfig()
     }
 }
 
+/// Average and minimal prices of the active auctions of an item entry
+void AuctionBotBuyer::FillSameItemInfo(AuctionHouseObject const* auctionHouse, uint32 itemEntry, BuyerItemInfo& buyerItem)
+{
+    AuctionHouseObject::AuctionIdSet const* auctionIds = auctionHouse->GetActiveAuctionsOfItem(itemEntry);
+    if (!auctionIds)
+        return;
+
+    for (AuctionHouseObject::AuctionIdSet::const_iterator itr = auctionIds->begin(); itr != auctionIds->end(); ++itr)
+    {
+        AuctionEntry* Aentry = auctionHouse->GetAuction(*itr);
+        if (!Aentry)
+            continue;
+
+        Item* item = sAuctionMgr.GetAItem(Aentry->itemGuidLow);
+        if (!item || !item->GetProto())
+            continue;
+
+        ++buyerItem.ItemCount;
+        buyerItem.BuyPrice = buyerItem.BuyPrice + (Aentry->buyout / item->GetCount());
+        buyerItem.BidPrice = buyerItem.BidPrice + (Aentry->startbid / item->GetCount());
+        if (Aentry->buyout != 0)
+        {
+            if (Aentry->buyout / item->GetCount() < buyerItem.MinBuyPrice)
+                buyerItem.MinBuyPrice = Aentry->buyout / item->GetCount();
+            else if (buyerItem.MinBuyPrice == 0)
+                buyerItem.MinBuyPrice = Aentry->buyout / item->GetCount();
+        }
+        if (Aentry->startbid / item->GetCount() < buyerItem.MinBidPrice)
+            buyerItem.MinBidPrice = Aentry->startbid / item->GetCount();
+        else if (buyerItem.MinBidPrice == 0)
+            buyerItem.MinBidPrice = Aentry->startbid / item->GetCount();
+    }
+}
+
 uint32 AuctionBotBuyer::GetBuyableEntry(AHB_Buyer_Config& config)
 {
     config.SameItemInfo.clear();
     uint32 count = 0;
     time_t Now = time(NULL);
 
-    AuctionHouseObject::AuctionEntryMapBounds bounds = sAuctionMgr.GetAuctionsMap(config.GetHouseType())->GetAuctionsBounds();
-    for (AuctionHouseObject::AuctionEntryMap::const_iterator itr = bounds.first; itr != bounds.second; ++itr)
+    AuctionHouseObject* auctionHouse = sAuctionMgr.GetAuctionsMap(config.GetHouseType());
+    AuctionHouseObject::AuctionIdSet const& candidates = auctionHouse->GetBuyerCandidates();
+    for (AuctionHouseObject::AuctionIdSet::const_iterator itr = candidates.begin(); itr != candidates.end(); ++itr)
     {
-        AuctionEntry* Aentry = itr->second;
-        Item* item = sAuctionMgr.GetAItem(Aentry->itemGuidLow);
-        if (item)
-        {
-            ItemPrototype const* prototype = item->GetProto();
-            if (prototype)
-            {
-                BuyerItemInfo& buyerItem = config.SameItemInfo[item->GetEntry()];    // Structure constructor will make sure Element are correctly initialised if entry is created here.
-                ++buyerItem.ItemCount;
-                buyerItem.BuyPrice = buyerItem.BuyPrice + (Aentry->buyout / item->GetCount());
-                buyerItem.BidPrice = buyerItem.BidPrice + (Aentry->startbid / item->GetCount());
-                if (Aentry->buyout != 0)
-                {
-                    if (Aentry->buyout / item->GetCount() < buyerItem.MinBuyPrice)
-                        buyerItem.MinBuyPrice = Aentry->buyout / item->GetCount();
-                    else if (buyerItem.MinBuyPrice == 0)
-                        buyerItem.MinBuyPrice = Aentry->buyout / item->GetCount();
-                }
-                if (Aentry->startbid / item->GetCount() < buyerItem.MinBidPrice)
-                    buyerItem.MinBidPrice = Aentry->startbid / item->GetCount();
-                else if (buyerItem.MinBidPrice == 0)
-                    buyerItem.MinBidPrice = Aentry->startbid / item->GetCount();
+        AuctionEntry* Aentry = auctionHouse->GetAuction(*itr);
+        if (!Aentry || !sAuctionMgr.GetAItem(Aentry->itemGuidLow))
+            continue;
 
-                if (!Aentry->owner)
-                {
-                    if ((Aentry->bid != 0) && Aentry->bidder) // Add bided by player
-                    {
-                        config.CheckedEntry[Aentry->Id].LastExist = Now;
-                        config.CheckedEntry[Aentry->Id].AuctionId = Aentry->Id;
-                        ++count;
-                    }
-                }
-                else
-                {
-                    if (Aentry->bid != 0)
-                    {
-                        if (Aentry->bidder)
-                        {
-                            config.CheckedEntry[Aentry->Id].LastExist = Now;
-                            config.CheckedEntry[Aentry->Id].AuctionId = Aentry->Id;
-                            ++count;
-                        }
-                    }
-                    else
-                    {
-                        config.CheckedEntry[Aentry->Id].LastExist = Now;
-                        config.CheckedEntry[Aentry->Id].AuctionId = Aentry->Id;
-                        ++count;
-                    }
-                }
-            }
-        }
+        // price info is collected only for the items the buyer can check
+        if (config.SameItemInfo.find(Aentry->itemTemplate) == config.SameItemInfo.end())
+            FillSameItemInfo(auctionHouse, Aentry->itemTemplate, config.SameItemInfo[Aentry->itemTemplate]);
+
+        config.CheckedEntry[Aentry->Id].LastExist = Now;
+        config.CheckedEntry[Aentry->Id].AuctionId = Aentry->Id;
+        ++count;
     }
 
     DEBUG_FILTER_LOG(LOG_FILTER_AHBOT_BUYER, "AHBot: %u items added to buyable vector for ah type: %u", count, config.GetHouseType());
@@ -1433,31 +1428,15 @@ void AuctionBotSeller::LoadSellerValues(AHB_Seller_Config& config)
 // Fill ItemInfos object with real content of AH.
 uint32 AuctionBotSeller::SetStat(AHB_Seller_Config& config)
 {
-    std::vector<std::vector<uint32> > ItemsInAH(MAX_AUCTION_QUALITY, std::vector< uint32 > (MAX_ITEM_CLASS));
+    // ahbot items are counted by the auction house as auctions are added, won and removed
+    AuctionHouseObject* auctionHouse = sAuctionMgr.GetAuctionsMap(config.GetHouseType());
 
-    AuctionHouseObject::AuctionEntryMapBounds bounds = sAuctionMgr.GetAuctionsMap(config.GetHouseType())->GetAuctionsBounds();
-    for (AuctionHouseObject::AuctionEntryMap::const_iterator itr = bounds.first; itr != bounds.second; ++itr)
-    {
-        AuctionEntry* Aentry = itr->second;
-        Item* item = sAuctionMgr.GetAItem(Aentry->itemGuidLow);
-        if (item)
-        {
-            ItemPrototype const* prototype = item->GetProto();
-            if (prototype)
-            {
-                if (!Aentry->owner)                         // Add only ahbot items
-                {
-                    ++ItemsInAH[prototype->Quality][prototype->Class];
-                }
-            }
-        }
-    }
     uint32 count = 0;
     for (uint32 j = 0; j < MAX_AUCTION_QUALITY; ++j)
     {
         for (uint32 i = 0; i < MAX_ITEM_CLASS; ++i)
         {
-            config.SetMissedItemsPerClass((AuctionQuality) j, (ItemClass) i, ItemsInAH[j][i]);
+            config.SetMissedItemsPerClass((AuctionQuality) j, (ItemClass) i, auctionHouse->GetItemCount(true, j, i));
             count += config.GetMissedItemsPerClass((AuctionQuality) j, (ItemClass) i);
         }
     }
@@ -1748,20 +1727,16 @@ void AuctionHouseBot::PrepareStatusInfos(AuctionHouseBotStatusInfo& statusInfo)
         for (int j = 0; j < MAX_AUCTION_QUALITY; ++j)
             statusInfo[i].QualityInfo[j] = 0;
 
-        AuctionHouseObject::AuctionEntryMapBounds bounds = sAuctionMgr.GetAuctionsMap(AuctionHouseType(i))->GetAuctionsBounds();
-        for (AuctionHouseObject::AuctionEntryMap::const_iterator itr = bounds.first; itr != bounds.second; ++itr)
+        AuctionHouseObject* auctionHouse = sAuctionMgr.GetAuctionsMap(AuctionHouseType(i));
+        for (uint32 j = 0; j < MAX_ITEM_QUALITY; ++j)
         {
-            AuctionEntry* Aentry = itr->second;
-            if (Item* item = sAuctionMgr.GetAItem(Aentry->itemGuidLow))
+            for (uint32 k = 0; k < MAX_ITEM_CLASS; ++k)
             {
-                ItemPrototype const* prototype = item->GetProto();
-                if (!Aentry->owner)                         // Add only ahbot items
-                {
-                    if (prototype->Quality < MAX_AUCTION_QUALITY)
-                        ++statusInfo[i].QualityInfo[prototype->Quality];
+                uint32 count = auctionHouse->GetItemCount(true, j, k);
+                if (j < MAX_AUCTION_QUALITY)
+                    statusInfo[i].QualityInfo[j] += count;
 
-                    ++statusInfo[i].ItemsCount;
-                }
+                statusInfo[i].ItemsCount += count;
             }
         }
     }
@@ -1771,13 +1746,19 @@ void AuctionHouseBot::Rebuild(bool all)
 {
     for (uint32 i = 0; i < MAX_AUCTION_HOUSE_TYPE; ++i)
     {
-        AuctionHouseObject::AuctionEntryMapBounds bounds = sAuctionMgr.GetAuctionsMap(AuctionHouseType(i))->GetAuctionsBounds();
+        AuctionHouseObject* auctionHouse = sAuctionMgr.GetAuctionsMap(AuctionHouseType(i));
+        AuctionHouseObject::AuctionEntryMapBounds bounds = auctionHouse->GetAuctionsBounds();
         for (AuctionHouseObject::AuctionEntryMap::const_iterator itr = bounds.first; itr != bounds.second; ++itr)
         {
             AuctionEntry* entry = itr->second;
             if (!entry->owner)                              // ahbot auction
+            {
                 if (all || entry->bid == 0)                 // expire now auction if no bid or forced
+                {
                     entry->expireTime = sWorld.GetGameTime();
+                    auctionHouse->ScheduleAuction(entry);
+                }
+            }
         }
     }
 }
@@ -1788,6 +1769,8 @@ void AuctionHouseBot::Update()
     if (!m_Buyer && !m_Seller)
         return;
 
+    uint32 updateStart = WorldTimer::getMSTime();
+
     // scan all possible update cases until first success
     for (uint32 count = 0; count < 2 * MAX_AUCTION_HOUSE_TYPE; ++count)
     {
@@ -1812,4 +1795,7 @@ void AuctionHouseBot::Update()
         if (successStep)
             break;
     }
+
+    uint32 updateTime = WorldTimer::getMSTimeDiff(updateStart, WorldTimer::getMSTime());
+    m_updateStats.Add(updateTime);
 }
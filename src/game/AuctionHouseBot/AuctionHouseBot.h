@@ -209,6 +209,9 @@ class AuctionHouseBot
         void Rebuild(bool all);
 
         void PrepareStatusInfos(AuctionHouseBotStatusInfo& statusInfo);
+
+        // update calls since the last call, their total and longest time in ms
+        UpdateTimeStats GetUpdateStats() { return m_updateStats.Collect(); }
     private:
         void InitilizeAgents();
 
@@ -216,6 +219,8 @@ class AuctionHouseBot
         AuctionBotAgent* m_Seller;
 
         uint32 m_OperationSelector;                         // 0..2*MAX_AUCTION_HOUSE_TYPE-1
+
+        UpdateTimeStats m_updateStats;
 };
 
 #define sAuctionBot MaNGOS::Singleton<AuctionHouseBot>::Instance()
@@ -479,8 +479,13 @@ bool AuctionHouseMgr::RemoveAItem(uint32 id)
 
 void AuctionHouseMgr::Update()
 {
+    uint32 updateStart = WorldTimer::getMSTime();
+
     for (int i = 0; i < MAX_AUCTION_HOUSE_TYPE; ++i)
         mAuctions[i].Update();
+
+    uint32 updateTime = WorldTimer::getMSTimeDiff(updateStart, WorldTimer::getMSTime());
+    m_updateStats.Add(updateTime);
 }
 
 uint32 AuctionHouseMgr::GetAuctionHouseTeam(AuctionHouseEntry const* house)
@@ -564,44 +569,105 @@ AuctionHouseEntry const* AuctionHouseMgr::GetAuctionHouseEntry(Unit* unit)
 void AuctionHouseObject::Update()
 {
     time_t curTime = sWorld.GetGameTime();
-    ///- Handle expired auctions
-    for (AuctionEntryMap::iterator itr = AuctionsMap.begin(); itr != AuctionsMap.end();)
+    ///- Handle expired auctions, in order of their next event time
+    while (!m_auctionEvents.empty() && curTime > m_auctionEvents.top().first)
     {
-        if (itr->second->moneyDeliveryTime)                 // pending auction
+        AuctionEvent event = m_auctionEvents.top();
+        m_auctionEvents.pop();
+
+        AuctionEntryMap::iterator itr = AuctionsMap.find(event.second);
+        if (itr == AuctionsMap.end())                       // already removed
+            continue;
+
+        AuctionEntry* auction = itr->second;
+        if (auction->GetNextEventTime() != event.first)     // rescheduled, has a newer event
+            continue;
+
+        if (auction->moneyDeliveryTime)                     // pending auction
         {
-            if (curTime > itr->second->moneyDeliveryTime)
-            {
-                sAuctionMgr.SendAuctionSuccessfulMail(itr->second);
+            sAuctionMgr.SendAuctionSuccessfulMail(auction);
 
-                itr->second->DeleteFromDB();
-                MANGOS_ASSERT(!itr->second->itemGuidLow);   // already removed or send in mail at won
-                delete itr->second;
-                AuctionsMap.erase(itr++);
-                continue;
-            }
+            auction->DeleteFromDB();
+            MANGOS_ASSERT(!auction->itemGuidLow);           // already removed or send in mail at won
+            delete auction;
+            AuctionsMap.erase(itr);                         // not counted since won
         }
         else                                                // active auction
         {
-            if (curTime > itr->second->expireTime)
+            ///- perform the transaction if there was bidder
+            if (auction->bid)
+                auction->AuctionBidWinning();
+            ///- cancel the auction if there was no bidder and clear the auction
+            else
             {
-                ///- perform the transaction if there was bidder
-                if (itr->second->bid)
-                    itr->second->AuctionBidWinning();
-                ///- cancel the auction if there was no bidder and clear the auction
-                else
-                {
-                    sAuctionMgr.SendAuctionExpiredMail(itr->second);
+                sAuctionMgr.SendAuctionExpiredMail(auction);
 
-                    itr->second->DeleteFromDB();
-                    delete itr->second;
-                    AuctionsMap.erase(itr++);
-                    continue;
-                }
+                auction->DeleteFromDB();
+                IndexActiveAuction(auction, false);
+                delete auction;
+                AuctionsMap.erase(itr);
             }
         }
+    }
+}
+
+void AuctionHouseObject::SetAuctionWon(AuctionEntry* ah, time_t deliveryTime)
+{
+    if (!ah->moneyDeliveryTime)
+        IndexActiveAuction(ah, false);
+
+    ah->moneyDeliveryTime = deliveryTime;
+    ScheduleAuction(ah);
+}
+
+static bool IsBuyerCandidate(AuctionEntry const* ah)
+{
+    if (ah->moneyDeliveryTime)
+        return false;
+
+    // ahbot auction: only when a player bid on it, else player auction: unless the ahbot is the current bidder
+    if (!ah->owner)
+        return ah->bid && ah->bidder;
+
+    return !ah->bid || ah->bidder;
+}
+
+void AuctionHouseObject::UpdateBuyerCandidate(AuctionEntry const* ah)
+{
+    if (IsBuyerCandidate(ah))
+        m_buyerCandidates.insert(ah->Id);
+    else
+        m_buyerCandidates.erase(ah->Id);
+}
 
-        ++itr;
+void AuctionHouseObject::IndexActiveAuction(AuctionEntry const* ah, bool add)
+{
+    if (add)
+    {
+        m_activeByItem[ah->itemTemplate].insert(ah->Id);
+        UpdateBuyerCandidate(ah);
+    }
+    else
+    {
+        AuctionsByItemMap::iterator itr = m_activeByItem.find(ah->itemTemplate);
+        if (itr != m_activeByItem.end())
+        {
+            itr->second.erase(ah->Id);
+            if (itr->second.empty())
+                m_activeByItem.erase(itr);
+        }
+        m_buyerCandidates.erase(ah->Id);
     }
+
+    ItemPrototype const* proto = ObjectMgr::GetItemPrototype(ah->itemTemplate);
+    if (!proto || proto->Quality >= MAX_ITEM_QUALITY || proto->Class >= MAX_ITEM_CLASS)
+        return;
+
+    uint32& count = m_itemCounts[ah->owner ? 0 : 1][proto->Quality][proto->Class];
+    if (add)
+        ++count;
+    else if (count)
+        --count;
 }
 
 void AuctionHouseObject::BuildListBidderItems(WorldPacket& data, Player* player, uint32& count, uint32& totalcount)
@@ -993,7 +1059,7 @@ void AuctionEntry::SaveToDB() const
 
 void AuctionEntry::AuctionBidWinning(Player* newbidder)
 {
-    moneyDeliveryTime = time(NULL) + HOUR;
+    sAuctionMgr.GetAuctionsMap(auctionHouseEntry)->SetAuctionWon(this, time(NULL) + HOUR);
 
     CharacterDatabase.BeginTransaction();
     CharacterDatabase.PExecute("UPDATE auction SET itemguid = 0, moneyTime = '" UI64FMTD "', buyguid = '%u', lastbid = '%u' WHERE id = '%u'", (uint64)moneyDeliveryTime, bidder, bid, Id);
@@ -1028,6 +1094,8 @@ bool AuctionEntry::UpdateBid(uint32 newbid, Player* newbidder /*=NULL*/)
     bidder = newbidder ? newbidder->GetGUIDLow() : 0;
     bid = newbid;
 
+    sAuctionMgr.GetAuctionsMap(auctionHouseEntry)->UpdateBuyerCandidate(this);
+
     if ((newbid < buyout) || (buyout == 0))                 // bid
     {
         if (auction_owner)
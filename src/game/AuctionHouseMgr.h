@@ -22,7 +22,9 @@
 #include "Common.h"
 #include "SharedDefines.h"
 #include "Policies/Singleton.h"
+#include "Timer.h"
 #include "DBCStructure.h"
+#include "ItemPrototype.h"
 
 class Item;
 class Player;
@@ -76,6 +78,8 @@ struct AuctionEntry
     uint32 GetHouseFaction() const { return auctionHouseEntry->faction; }
     uint32 GetAuctionCut() const;
     uint32 GetAuctionOutBid() const;
+    // time of the next update step: money delivery for pending auctions, else expiration
+    time_t GetNextEventTime() const { return moneyDeliveryTime ? moneyDeliveryTime : expireTime; }
     bool BuildAuctionInfo(WorldPacket& data) const;
     void DeleteFromDB() const;
     void SaveToDB() const;
@@ -91,7 +95,10 @@ struct AuctionEntry
 class AuctionHouseObject
 {
     public:
-        AuctionHouseObject() {}
+        AuctionHouseObject()
+        {
+            memset(m_itemCounts, 0, sizeof(m_itemCounts));
+        }
         ~AuctionHouseObject()
         {
             for (AuctionEntryMap::const_iterator itr = AuctionsMap.begin(); itr != AuctionsMap.end(); ++itr)
@@ -100,6 +107,8 @@ class AuctionHouseObject
 
         typedef std::map<uint32, AuctionEntry*> AuctionEntryMap;
         typedef std::pair<AuctionEntryMap::const_iterator, AuctionEntryMap::const_iterator> AuctionEntryMapBounds;
+        typedef std::set<uint32> AuctionIdSet;
+        typedef std::map<uint32 /*item entry*/, AuctionIdSet> AuctionsByItemMap;
 
         uint32 GetCount() { return AuctionsMap.size(); }
 
@@ -110,6 +119,15 @@ class AuctionHouseObject
         {
             MANGOS_ASSERT(ah);
             AuctionsMap[ah->Id] = ah;
+            ScheduleAuction(ah);
+            if (!ah->moneyDeliveryTime)
+                IndexActiveAuction(ah, true);
+        }
+
+        // must be called after changing expireTime or moneyDeliveryTime of an auction of this house
+        void ScheduleAuction(AuctionEntry const* ah)
+        {
+            m_auctionEvents.push(AuctionEvent(ah->GetNextEventTime(), ah->Id));
         }
 
         AuctionEntry* GetAuction(uint32 id) const
@@ -120,9 +138,38 @@ class AuctionHouseObject
 
         bool RemoveAuction(uint32 id)
         {
-            return AuctionsMap.erase(id);
+            AuctionEntryMap::iterator itr = AuctionsMap.find(id);
+            if (itr == AuctionsMap.end())
+                return false;
+
+            if (!itr->second->moneyDeliveryTime)
+                IndexActiveAuction(itr->second, false);
+            AuctionsMap.erase(itr);
+            return true;
+        }
+
+        // the auction was won, its item left the house and the money is delivered to the owner at deliveryTime
+        void SetAuctionWon(AuctionEntry* ah, time_t deliveryTime);
+
+        // items of active auctions, by owner kind (player or ahbot), quality and class
+        uint32 GetItemCount(bool botOwned, uint32 quality, uint32 itemClass) const
+        {
+            return quality < MAX_ITEM_QUALITY && itemClass < MAX_ITEM_CLASS ? m_itemCounts[botOwned ? 1 : 0][quality][itemClass] : 0;
         }
 
+        // active auctions the ahbot buyer can bid on or buy: player auctions without ahbot bid, ahbot auctions with player bid
+        AuctionIdSet const& GetBuyerCandidates() const { return m_buyerCandidates; }
+
+        // active auctions of an item entry, NULL if there are none
+        AuctionIdSet const* GetActiveAuctionsOfItem(uint32 itemEntry) const
+        {
+            AuctionsByItemMap::const_iterator itr = m_activeByItem.find(itemEntry);
+            return itr != m_activeByItem.end() ? &itr->second : NULL;
+        }
+
+        // must be called after changing bid or bidder of an auction of this house
+        void UpdateBuyerCandidate(AuctionEntry const* ah);
+
         void Update();
 
         void BuildListBidderItems(WorldPacket& data, Player* player, uint32& count, uint32& totalcount);
@@ -132,6 +179,16 @@ class AuctionHouseObject
         AuctionEntry* AddAuction(AuctionHouseEntry const* auctionHouseEntry, Item* newItem, uint32 etime, uint32 bid, uint32 buyout = 0, uint32 deposit = 0, Player* pl = NULL);
     private:
         AuctionEntryMap AuctionsMap;
+
+        // min-heap of (event time, auction id), entries of removed or rescheduled auctions are skipped when reached
+        typedef std::pair<time_t, uint32> AuctionEvent;
+        typedef std::priority_queue<AuctionEvent, std::vector<AuctionEvent>, std::greater<AuctionEvent> > AuctionEventQueue;
+        AuctionEventQueue m_auctionEvents;
+
+        void IndexActiveAuction(AuctionEntry const* ah, bool add);
+        uint32 m_itemCounts[2][MAX_ITEM_QUALITY][MAX_ITEM_CLASS];
+        AuctionsByItemMap m_activeByItem;
+        AuctionIdSet m_buyerCandidates;
 };
 
 class AuctionSorter
@@ -195,9 +252,14 @@ class AuctionHouseMgr
 
         void Update();
 
+        // update passes since the last call, their total and longest time in ms
+        UpdateTimeStats GetUpdateStats() { return m_updateStats.Collect(); }
+
     private:
         AuctionHouseObject  mAuctions[MAX_AUCTION_HOUSE_TYPE];
 
+        UpdateTimeStats     m_updateStats;
+
         ItemMap             mAitems;
 };
 
@@ -72,6 +72,7 @@ void CalendarEvent::RemoveInviteByItr(CalendarInviteMap::iterator inviteItr)
         sCalendarMgr.SendCalendarEventInviteRemoveAlert(sObjectMgr.GetPlayer(inviteItr->second->InviteeGuid), this, CALENDAR_STATUS_REMOVED);
 
     sCalendarMgr.SendCalendarEventInviteRemove(inviteItr->second, Flags);
+    sCalendarMgr.UnindexInvite(inviteItr->second);
 
     CharacterDatabase.PExecute("DELETE FROM calendar_invites WHERE inviteId=" UI64FMTD, inviteItr->second->InviteId);
 
@@ -202,45 +203,110 @@ void CalendarMgr::GetPlayerEventsList(ObjectGuid const& guid, CalendarEventsList
     else
         guildId = Player::GetGuildIdFromDB(guid);
 
-    for (CalendarEventStore::iterator itr = m_EventStore.begin(); itr != m_EventStore.end(); ++itr)
-    {
-        CalendarEvent* event = &itr->second;
+    // collect ids first, an event can be found by more than one index
+    CalendarEventIdSet eventIds;
+
+    // add own event
+    CalendarCreatorEventIndex::const_iterator creatorItr = m_CreatorEventIndex.find(guid);
+    if (creatorItr != m_CreatorEventIndex.end())
+        eventIds.insert(creatorItr->second.begin(), creatorItr->second.end());
 
-        // add own event and same guild event or announcement
-        if ((event->CreatorGuid == guid) || ((event->IsGuildAnnouncement() || event->IsGuildEvent()) && event->GuildId == guildId))
+    // add same guild event or announcement
+    CalendarGuildEventIndex::const_iterator guildItr = guildId ? m_GuildEventIndex.find(guildId) : m_GuildEventIndex.end();
+    if (guildItr != m_GuildEventIndex.end())
+    {
+        for (CalendarEventIdSet::const_iterator itr = guildItr->second.begin(); itr != guildItr->second.end(); ++itr)
         {
-            calEventList.push_back(event);
-            continue;
+            CalendarEvent const* event = GetEventById(*itr);
+            if (event && (event->IsGuildAnnouncement() || event->IsGuildEvent()))
+                eventIds.insert(*itr);
         }
+    }
+
+    // add all event where player is invited
+    CalendarInviteeIndex::const_iterator inviteeItr = m_InviteeIndex.find(guid);
+    if (inviteeItr != m_InviteeIndex.end())
+        for (CalendarInviteMap::const_iterator itr = inviteeItr->second.begin(); itr != inviteeItr->second.end(); ++itr)
+            eventIds.insert(itr->first);
 
-        // add all event where player is invited
-        if (event->GetInviteByGuid(guid))
+    for (CalendarEventIdSet::const_iterator itr = eventIds.begin(); itr != eventIds.end(); ++itr)
+        if (CalendarEvent* event = GetEventById(*itr))
             calEventList.push_back(event);
-    }
 }
 
 // fill all player invites in provided CalendarInvitesList
 void CalendarMgr::GetPlayerInvitesList(ObjectGuid const& guid, CalendarInvitesList& calInvList)
 {
-    for (CalendarEventStore::iterator itr = m_EventStore.begin(); itr != m_EventStore.end(); ++itr)
+    CalendarInviteeIndex::const_iterator inviteeItr = m_InviteeIndex.find(guid);
+    if (inviteeItr == m_InviteeIndex.end())
+        return;
+
+    for (CalendarInviteMap::const_iterator itr = inviteeItr->second.begin(); itr != inviteeItr->second.end(); ++itr)
     {
-        CalendarEvent* event = &itr->second;
+        CalendarInvite* invite = itr->second;
 
-        if (event->IsGuildAnnouncement())
+        if (invite->GetCalendarEvent()->IsGuildAnnouncement())
             continue;
 
-        CalendarInviteMap const* cInvMap = event->GetInviteMap();
-        CalendarInviteMap::const_iterator ci_itr = cInvMap->begin();
-        while (ci_itr != cInvMap->end())
-        {
-            if (ci_itr->second->InviteeGuid == guid)
-            {
-                calInvList.push_back(ci_itr->second);
-                break;
-            }
-            ++ci_itr;
-        }
+        calInvList.push_back(invite);
+    }
+}
+
+// add event to the creator and guild indexes
+void CalendarMgr::IndexEvent(CalendarEvent const& event)
+{
+    m_CreatorEventIndex[event.CreatorGuid].insert(event.EventId);
+
+    // guild id is set only for guild events and announcements
+    if (event.GuildId)
+        m_GuildEventIndex[event.GuildId].insert(event.EventId);
+}
+
+// remove event from the store and all indexes
+void CalendarMgr::EraseEvent(CalendarEventStore::iterator itr)
+{
+    CalendarEvent const& event = itr->second;
+
+    CalendarCreatorEventIndex::iterator creatorItr = m_CreatorEventIndex.find(event.CreatorGuid);
+    if (creatorItr != m_CreatorEventIndex.end())
+    {
+        creatorItr->second.erase(event.EventId);
+        if (creatorItr->second.empty())
+            m_CreatorEventIndex.erase(creatorItr);
     }
+
+    CalendarGuildEventIndex::iterator guildItr = m_GuildEventIndex.find(event.GuildId);
+    if (guildItr != m_GuildEventIndex.end())
+    {
+        guildItr->second.erase(event.EventId);
+        if (guildItr->second.empty())
+            m_GuildEventIndex.erase(guildItr);
+    }
+
+    // remaining invites are unindexed by the event destructor
+    m_EventStore.erase(itr);
+}
+
+// add invite to the invitee index, first invite of a player to an event is kept
+void CalendarMgr::IndexInvite(CalendarInvite* invite)
+{
+    m_InviteeIndex[invite->InviteeGuid].insert(CalendarInviteMap::value_type(invite->GetCalendarEvent()->EventId, invite));
+}
+
+// remove invite from the invitee index
+void CalendarMgr::UnindexInvite(CalendarInvite const* invite)
+{
+    CalendarInviteeIndex::iterator inviteeItr = m_InviteeIndex.find(invite->InviteeGuid);
+    if (inviteeItr == m_InviteeIndex.end())
+        return;
+
+    CalendarInviteMap::iterator itr = inviteeItr->second.find(invite->GetCalendarEvent()->EventId);
+    if (itr == inviteeItr->second.end() || itr->second != invite)
+        return;
+
+    inviteeItr->second.erase(itr);
+    if (inviteeItr->second.empty())
+        m_InviteeIndex.erase(inviteeItr);
 }
 
 // add single event to main events store
@@ -309,6 +375,8 @@ CalendarEvent* CalendarMgr::AddEvent(ObjectGuid const& guid, std::string title,
     newEvent.Flags = flags;
     newEvent.GuildId = guildId;
 
+    IndexEvent(newEvent);
+
     CharacterDatabase.escape_string(title);
     CharacterDatabase.escape_string(description);
     CharacterDatabase.PExecute("INSERT INTO calendar_events VALUES ("UI64FMTD", %u, %u, %u, %u, %d, %u, '%s', '%s')",
@@ -348,7 +416,7 @@ void CalendarMgr::RemoveEvent(uint64 eventId, Player* remover)
 
     // explicitly remove all invite and send mail to all invitee
     citr->second.RemoveAllInvite(remover->GetObjectGuid());
-    m_EventStore.erase(citr);
+    EraseEvent(citr);
 }
 
 // Add invit to an event and inform client
@@ -405,6 +473,8 @@ CalendarInvite* CalendarMgr::AddInvite(CalendarEvent* event, ObjectGuid const& s
         return NULL;
     }
 
+    IndexInvite(invite);
+
     CharacterDatabase.PExecute("INSERT INTO calendar_invites VALUES ("UI64FMTD", "UI64FMTD", %u, %u, %u, %u, %u)",
                                invite->InviteId,
                                event->EventId,
@@ -516,50 +586,68 @@ void CalendarMgr::CopyEvent(uint64 eventId, time_t newTime, ObjectGuid const& gu
 // used when player is deleted
 void CalendarMgr::RemovePlayerCalendar(ObjectGuid const& playerGuid)
 {
-    CalendarEventStore::iterator itr = m_EventStore.begin();
-
-    while (itr != m_EventStore.end())
+    // copy ids, the indexes are changed while removing
+    CalendarEventIdSet eventIds;
+    CalendarCreatorEventIndex::const_iterator creatorItr = m_CreatorEventIndex.find(playerGuid);
+    if (creatorItr != m_CreatorEventIndex.end())
+        eventIds = creatorItr->second;
+
+    // all invite will be automaticaly deleted
+    for (CalendarEventIdSet::const_iterator itr = eventIds.begin(); itr != eventIds.end(); ++itr)
     {
-        if (itr->second.CreatorGuid == playerGuid)
-        {
-            // all invite will be automaticaly deleted
-            m_EventStore.erase(itr++);
-            // itr already incremented so go recheck event owner
-            continue;
-        }
-        // event not owned by playerGuid but an invite can still be found
-        CalendarEvent* event = &itr->second;
-        event->RemoveInviteByGuid(playerGuid);
-        ++itr;
+        CalendarEventStore::iterator eventItr = m_EventStore.find(*itr);
+        if (eventItr != m_EventStore.end())
+            EraseEvent(eventItr);
     }
+
+    // event not owned by playerGuid but an invite can still be found
+    eventIds.clear();
+    CalendarInviteeIndex::const_iterator inviteeItr = m_InviteeIndex.find(playerGuid);
+    if (inviteeItr != m_InviteeIndex.end())
+        for (CalendarInviteMap::const_iterator itr = inviteeItr->second.begin(); itr != inviteeItr->second.end(); ++itr)
+            eventIds.insert(itr->first);
+
+    for (CalendarEventIdSet::const_iterator itr = eventIds.begin(); itr != eventIds.end(); ++itr)
+        if (CalendarEvent* event = GetEventById(*itr))
+            event->RemoveInviteByGuid(playerGuid);
 }
 
 // remove all events and invite of player related to a specific guild
 // used when player quit a guild
 void CalendarMgr::RemoveGuildCalendar(ObjectGuid const& playerGuid, uint32 GuildId)
 {
-    CalendarEventStore::iterator itr = m_EventStore.begin();
+    // copy ids, the indexes are changed while removing
+    CalendarEventIdSet eventIds;
+    CalendarCreatorEventIndex::const_iterator creatorItr = m_CreatorEventIndex.find(playerGuid);
+    if (creatorItr != m_CreatorEventIndex.end())
+        eventIds = creatorItr->second;
 
-    while (itr != m_EventStore.end())
+    for (CalendarEventIdSet::const_iterator itr = eventIds.begin(); itr != eventIds.end(); ++itr)
     {
-        CalendarEvent* event = &itr->second;
-        if (event->CreatorGuid == playerGuid && (event->IsGuildEvent() || event->IsGuildAnnouncement()))
-        {
-            // all invite will be automaticaly deleted
-            m_EventStore.erase(itr++);
-            // itr already incremented so go recheck event owner
+        CalendarEventStore::iterator eventItr = m_EventStore.find(*itr);
+        if (eventItr == m_EventStore.end())
             continue;
-        }
 
-        // event not owned by playerGuid but an guild invite can still be found
-        if (event->GuildId != GuildId || !(event->IsGuildEvent() || event->IsGuildAnnouncement()))
-        {
-            ++itr;
+        // all invite will be automaticaly deleted
+        CalendarEvent const& event = eventItr->second;
+        if (event.IsGuildEvent() || event.IsGuildAnnouncement())
+            EraseEvent(eventItr);
+    }
+
+    // event not owned by playerGuid but an guild invite can still be found
+    eventIds.clear();
+    CalendarInviteeIndex::const_iterator inviteeItr = m_InviteeIndex.find(playerGuid);
+    if (inviteeItr != m_InviteeIndex.end())
+        for (CalendarInviteMap::const_iterator itr = inviteeItr->second.begin(); itr != inviteeItr->second.end(); ++itr)
+            eventIds.insert(itr->first);
+
+    for (CalendarEventIdSet::const_iterator itr = eventIds.begin(); itr != eventIds.end(); ++itr)
+    {
+        CalendarEvent* event = GetEventById(*itr);
+        if (!event || event->GuildId != GuildId || !(event->IsGuildEvent() || event->IsGuildAnnouncement()))
             continue;
-        }
 
         event->RemoveInviteByGuid(playerGuid);
-        ++itr;
     }
 }
 
@@ -570,6 +658,9 @@ void CalendarMgr::LoadCalendarsFromDB()
     m_MaxInviteId = 0;
     m_MaxEventId = 0;
     m_EventStore.clear();
+    m_CreatorEventIndex.clear();
+    m_GuildEventIndex.clear();
+    m_InviteeIndex.clear();
 
     sLog.outString("Loading Calendar Events...");
 
@@ -604,6 +695,8 @@ void CalendarMgr::LoadCalendarsFromDB()
             newEvent.Title         = field[7].GetCppString();
             newEvent.Description   = field[8].GetCppString();
 
+            IndexEvent(newEvent);
+
             m_MaxEventId = std::max(eventId, m_MaxEventId);
         }
         while (eventsQuery->NextRow());
@@ -625,6 +718,8 @@ void CalendarMgr::LoadCalendarsFromDB()
         {
             // delete all events (no event exist without at least one invite)
             m_EventStore.clear();
+            m_CreatorEventIndex.clear();
+            m_GuildEventIndex.clear();
             m_MaxEventId = 0;
             CharacterDatabase.DirectExecute("TRUNCATE TABLE calendar_events");
             sLog.outString(">> calendar_invites table is empty, cleared calendar_events table!");
@@ -663,7 +758,8 @@ void CalendarMgr::LoadCalendarsFromDB()
                 }
 
                 CalendarInvite* invite = new CalendarInvite(event, inviteId, senderGuid, inviteeGuid, lastUpdateTime, status, rank, "");
-                event->AddInvite(invite);
+                if (event->AddInvite(invite))
+                    IndexInvite(invite);
                 ++totalInvites;
                 m_MaxInviteId = std::max(inviteId, m_MaxInviteId);
             }
@@ -685,12 +781,9 @@ void CalendarMgr::LoadCalendarsFromDB()
 // check if player have not reached event limit
 bool CalendarMgr::CanAddEvent(ObjectGuid const& guid)
 {
-    uint32 totalEvents = 0;
     // count all event created by guid
-    for (CalendarEventStore::iterator itr = m_EventStore.begin(); itr != m_EventStore.end(); ++itr)
-        if ((itr->second.CreatorGuid == guid) && (++totalEvents >= CALENDAR_MAX_EVENTS))
-            return false;
-    return true;
+    CalendarCreatorEventIndex::const_iterator itr = m_CreatorEventIndex.find(guid);
+    return itr == m_CreatorEventIndex.end() || itr->second.size() < CALENDAR_MAX_EVENTS;
 }
 
 // check if guild have not reached event limit
@@ -699,34 +792,26 @@ bool CalendarMgr::CanAddGuildEvent(uint32 guildId)
     if (!guildId)
         return false;
 
-    uint32 totalEvents = 0;
     // count all guild events in a guild
-    for (CalendarEventStore::iterator itr = m_EventStore.begin(); itr != m_EventStore.end(); ++itr)
-        if ((itr->second.GuildId == guildId) && (++totalEvents >= CALENDAR_MAX_GUILD_EVENTS))
-            return false;
-    return true;
+    CalendarGuildEventIndex::const_iterator itr = m_GuildEventIndex.find(guildId);
+    return itr == m_GuildEventIndex.end() || itr->second.size() < CALENDAR_MAX_GUILD_EVENTS;
 }
 
 // check if an invitee have not reached invite limit
 bool CalendarMgr::CanAddInviteTo(ObjectGuid const& guid)
 {
-    uint32 totalInvites = 0;
+    CalendarInviteeIndex::const_iterator inviteeItr = m_InviteeIndex.find(guid);
+    if (inviteeItr == m_InviteeIndex.end())
+        return true;
 
-    for (CalendarEventStore::iterator itr = m_EventStore.begin(); itr != m_EventStore.end(); ++itr)
+    uint32 totalInvites = 0;
+    for (CalendarInviteMap::const_iterator itr = inviteeItr->second.begin(); itr != inviteeItr->second.end(); ++itr)
     {
-        CalendarEvent* event = &itr->second;
-
-        if (event->IsGuildAnnouncement())
+        if (itr->second->GetCalendarEvent()->IsGuildAnnouncement())
             continue;
 
-        CalendarInviteMap const* cInvMap = event->GetInviteMap();
-        CalendarInviteMap::const_iterator ci_itr = cInvMap->begin();
-        while (ci_itr != cInvMap->end())
-        {
-            if ((ci_itr->second->InviteeGuid == guid) && (++totalInvites >= CALENDAR_MAX_INVITES))
-                return false;
-            ++ci_itr;
-        }
+        if (++totalInvites >= CALENDAR_MAX_INVITES)
+            return false;
     }
 
     return true;
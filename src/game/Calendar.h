@@ -215,6 +215,12 @@ class CalendarInvite
 // storage for all events
 typedef std::map<uint64, CalendarEvent> CalendarEventStore;
 
+// lookup indexes of the events store
+typedef std::set<uint64> CalendarEventIdSet;
+typedef std::map<ObjectGuid, CalendarEventIdSet> CalendarCreatorEventIndex;    // creator guid -> own events
+typedef std::map<uint32, CalendarEventIdSet> CalendarGuildEventIndex;          // guild id -> guild events and announcements
+typedef std::map<ObjectGuid, CalendarInviteMap> CalendarInviteeIndex;          // invitee guid -> invites keyed by event id
+
 // CalendarMgr class is the main class to handle events and their invites
 class CalendarMgr
 {
@@ -264,6 +270,10 @@ class CalendarMgr
 
         void SendPacketToAllEventRelatives(WorldPacket packet, CalendarEvent const* event);
 
+        // invitee index maintenance, invites are only removed by their event
+        void IndexInvite(CalendarInvite* invite);
+        void UnindexInvite(CalendarInvite const* invite);
+
     private:
         uint64 GetNewEventId() { return ++m_MaxEventId; }
         uint64 GetNewInviteId() { return ++m_MaxInviteId; }
@@ -272,6 +282,14 @@ class CalendarMgr
         bool CanAddGuildEvent(uint32 guildId);          // check if guild not reached the event number limit
         bool CanAddEvent(ObjectGuid const& guid);       // check if player not reached the event number limit
 
+        void IndexEvent(CalendarEvent const& event);
+        void EraseEvent(CalendarEventStore::iterator itr);
+
+        // indexes declared before the store, event destructors unindex their invites
+        CalendarCreatorEventIndex m_CreatorEventIndex;
+        CalendarGuildEventIndex m_GuildEventIndex;
+        CalendarInviteeIndex m_InviteeIndex;
+
         CalendarEventStore m_EventStore;        // main events storage
         uint64 m_MaxEventId;                    // current max event ID
         uint64 m_MaxInviteId;                   // current max invite ID
@@ -115,7 +115,7 @@ bool LoginQueryHolder::Initialize()
 class CharacterHandler
 {
     public:
-        void HandleCharEnumCallback(QueryResult* result, uint32 account)
+        void HandleCharEnumCallback(QueryResult* result, uint32 account, uint32 queryId)
         {
             WorldSession* session = sWorld.FindSession(account);
             if (!session)
@@ -123,7 +123,7 @@ class CharacterHandler
                 delete result;
                 return;
             }
-            session->HandleCharEnum(result);
+            session->HandleCharEnum(result, queryId);
         }
         void HandlePlayerLoginCallback(QueryResult* /*dummy*/, SqlQueryHolder* holder)
         {
@@ -138,9 +138,19 @@ class CharacterHandler
         }
 } chrHandler;
 
-void WorldSession::HandleCharEnum(QueryResult* result)
+void WorldSession::HandleCharEnum(QueryResult* result, uint32 queryId)
 {
+    // an older query, the list changed since it was issued
+    if (queryId != m_charEnumQuery)
+    {
+        delete result;
+        return;
+    }
+
+    m_charEnumLoading = false;
+
     WorldPacket data(SMSG_CHAR_ENUM, 100);                  // we guess size
+    std::vector<uint32> guids;
 
     uint8 num = 0;
 
@@ -154,6 +164,7 @@ void WorldSession::HandleCharEnum(QueryResult* result)
             DETAIL_LOG("Build enum data for char guid %u from account %u.", guidlow, GetAccountId());
             if (Player::BuildEnumData(result, &data))
                 ++num;
+            guids.push_back(guidlow);
         }
         while (result->NextRow());
 
@@ -162,13 +173,48 @@ void WorldSession::HandleCharEnum(QueryResult* result)
 
     data.put<uint8>(0, num);
 
-    SendPacket(&data);
+    if (m_charEnumRequested)
+    {
+        m_charEnumRequested = false;
+        SendPacket(&data);
+    }
+
+    // keep it for the next visits of the character screen
+    if (!m_charEnumStale)
+    {
+        delete m_charEnum;
+        m_charEnum = new WorldPacket(data);
+        m_charEnumGuids.swap(guids);
+    }
 }
 
 void WorldSession::HandleCharEnumOpcode(WorldPacket& /*recv_data*/)
 {
+    if (m_charEnum)
+    {
+        SendPacket(m_charEnum);
+        return;
+    }
+
+    m_charEnumRequested = true;
+
+    // the list is already on its way
+    if (m_charEnumLoading && !m_charEnumStale)
+        return;
+
+    LoadCharEnum();
+}
+
+void WorldSession::LoadCharEnum()
+{
+    static uint32 queryCounter = 0;
+
+    m_charEnumQuery = ++queryCounter;
+    m_charEnumLoading = true;
+    m_charEnumStale = false;
+
     /// get all the data necessary for loading all characters (along with their pets) on the account
-    CharacterDatabase.AsyncPQuery(&chrHandler, &CharacterHandler::HandleCharEnumCallback, GetAccountId(),
+    CharacterDatabase.AsyncPQuery(&chrHandler, &CharacterHandler::HandleCharEnumCallback, GetAccountId(), m_charEnumQuery,
                                   !sWorld.getConfig(CONFIG_BOOL_DECLINED_NAMES_USED) ?
                                   //   ------- Query Without Declined Names --------
                                   //           0               1                2                3                 4                  5                       6                        7
@@ -195,6 +241,24 @@ void WorldSession::HandleCharEnumOpcode(WorldPacket& /*recv_data*/)
                                   PET_SAVE_AS_CURRENT, GetAccountId());
 }
 
+void WorldSession::InvalidateCharEnum()
+{
+    delete m_charEnum;
+    m_charEnum = NULL;
+    m_charEnumGuids.clear();
+
+    if (m_charEnumLoading)
+        m_charEnumStale = true;
+}
+
+bool WorldSession::IsCharEnumListing(uint32 lowguid) const
+{
+    if (m_charEnumLoading)
+        return true;
+
+    return std::find(m_charEnumGuids.begin(), m_charEnumGuids.end(), lowguid) != m_charEnumGuids.end();
+}
+
 void WorldSession::HandleCharCreateOpcode(WorldPacket& recv_data)
 {
     std::string name;
@@ -475,6 +539,8 @@ void WorldSession::HandleCharCreateOpcode(WorldPacket& recv_data)
     LoginDatabase.PExecute("DELETE FROM realmcharacters WHERE acctid= '%u' AND realmid = '%u'", GetAccountId(), realmID);
     LoginDatabase.PExecute("INSERT INTO realmcharacters (numchars, acctid, realmid) VALUES (%u, %u, %u)",  charcount, GetAccountId(), realmID);
 
+    InvalidateCharEnum();
+
     data << (uint8)CHAR_CREATE_SUCCESS;
     SendPacket(&data);
 
@@ -982,6 +1048,8 @@ void WorldSession::HandleChangePlayerNameOpcodeCallBack(QueryResult* result, uin
     CharacterDatabase.PExecute("DELETE FROM character_declinedname WHERE guid ='%u'", guidLow);
     CharacterDatabase.CommitTransaction();
 
+    session->InvalidateCharEnum();
+
     sLog.outChar("Account: %d (IP: %s) Character:[%s] (guid:%u) Changed name to: %s", session->GetAccountId(), session->GetRemoteAddress().c_str(), oldname.c_str(), guidLow, newname.c_str());
 
     WorldPacket data(SMSG_CHAR_RENAME, 1 + 8 + (newname.size() + 1));
@@ -1074,6 +1142,8 @@ void WorldSession::HandleSetPlayerDeclinedNamesOpcode(WorldPacket& recv_data)
                                guid.GetCounter(), declinedname.name[0].c_str(), declinedname.name[1].c_str(), declinedname.name[2].c_str(), declinedname.name[3].c_str(), declinedname.name[4].c_str());
     CharacterDatabase.CommitTransaction();
 
+    InvalidateCharEnum();
+
     WorldPacket data(SMSG_SET_PLAYER_DECLINED_NAMES_RESULT, 4 + 8);
     data << uint32(0);                                      // OK
     data << ObjectGuid(guid);
@@ -1232,6 +1302,8 @@ void WorldSession::HandleCharCustomizeOpcode(WorldPacket& recv_data)
     CharacterDatabase.PExecute("UPDATE characters set name = '%s', at_login = at_login & ~ %u WHERE guid ='%u'", newname.c_str(), uint32(AT_LOGIN_CUSTOMIZE), guid.GetCounter());
     CharacterDatabase.PExecute("DELETE FROM character_declinedname WHERE guid ='%u'", guid.GetCounter());
 
+    InvalidateCharEnum();
+
     std::string IP_str = GetRemoteAddress();
     sLog.outChar("Account: %d (IP: %s), Character %s customized to: %s", GetAccountId(), IP_str.c_str(), guid.GetString().c_str(), newname.c_str());
 
@@ -138,7 +138,7 @@ Creature::Creature(CreatureSubtype subtype) : Unit(),
     lootForPickPocketed(false), lootForBody(false), lootForSkin(false),
     m_groupLootTimer(0), m_groupLootId(0),
     m_lootMoney(0), m_lootGroupRecipientId(0),
-    m_corpseDecayTimer(0), m_respawnTime(0), m_respawnDelay(25), m_corpseDelay(60), m_aggroDelay(0), m_respawnradius(5.0f),
+    m_corpseDecayTimer(0), m_respawnTime(0), m_respawnDelay(25), m_corpseDelay(60), m_aggroDelay(0), m_idleSkippedDiff(0), m_idleSkippedUpdateId(0), m_respawnradius(5.0f),
     m_subtype(subtype), m_defaultMovementType(IDLE_MOTION_TYPE), m_equipmentId(0),
     m_AlreadyCallAssistance(false), m_AlreadySearchedAssistance(false),
     m_AI_locked(false), m_isDeadByDefault(false), m_temporaryFactionFlags(TEMPFACTION_NONE),
@@ -613,6 +613,29 @@ void Creature::Update(uint32 update_diff, uint32 diff)
     }
 }
 
+/// Creature may be updated at a reduced rate when no player is near: nothing it does needs per tick precision
+bool Creature::CanUseIdleUpdateRate() const
+{
+    if (IsPet() || IsTotem() || isActiveObject() || IsVehicle() || IsBoarded())
+        return false;
+
+    if (GetOwnerGuid() || GetCharmerGuid())
+        return false;
+
+    if (isInCombat() || IsInEvadeMode() || IsNonMeleeSpellCasted(false))
+        return false;
+
+    return true;
+}
+
+/// Idle updates of one interval are spread over the interval by guid instead of all happening in the same map update
+bool Creature::IsIdleUpdateDue(uint32 interval) const
+{
+    uint32 now = WorldTimer::tickTime() + GetGUIDLow() % interval;
+    uint32 last = now - m_idleSkippedDiff;
+    return now / interval != last / interval || m_idleSkippedDiff >= interval;
+}
+
 void Creature::StartGroupLoot(Group* group, uint32 timer)
 {
     m_groupLootId = group->GetId();
@@ -437,6 +437,16 @@ enum VirtualItemSlot
 
 #define MAX_VIRTUAL_ITEM_SLOT 3
 
+// rate at which a creature in an active cell was handled in a map update
+enum CreatureUpdateTier
+{
+    CREATURE_UPDATE_TIER_FULL       = 0,                    // updated at every map update (busy, or close to a player)
+    CREATURE_UPDATE_TIER_IDLE       = 1,                    // idle and far from players, updated at Visibility.IdleUpdate.Interval
+    CREATURE_UPDATE_TIER_DEFERRED   = 2,                    // idle update skipped, the time is added to the next one
+};
+
+#define MAX_CREATURE_UPDATE_TIER 3
+
 struct CreatureCreatePos
 {
     public:
@@ -508,6 +518,13 @@ class MANGOS_DLL_SPEC Creature : public Unit
 
         void Update(uint32 update_diff, uint32 time) override;  // overwrite Unit::Update
 
+        bool CanUseIdleUpdateRate() const;
+        bool IsIdleUpdateDue(uint32 interval) const;
+        void DeferIdleUpdate(uint32 diff, uint32 mapUpdateId) { m_idleSkippedDiff += diff; m_idleSkippedUpdateId = mapUpdateId; }
+        // skipped time is only owed over consecutive map updates, not after the cell was out of the active area
+        void DropStaleIdleSkippedDiff(uint32 mapUpdateId) { if (m_idleSkippedUpdateId + 1 != mapUpdateId) m_idleSkippedDiff = 0; }
+        uint32 TakeIdleSkippedDiff(uint32 diff) { diff += m_idleSkippedDiff; m_idleSkippedDiff = 0; return diff; }
+
         virtual void RegenerateAll(uint32 update_diff);
         uint32 GetEquipmentId() const { return m_equipmentId; }
 
@@ -764,6 +781,8 @@ class MANGOS_DLL_SPEC Creature : public Unit
         uint32 m_respawnDelay;                              // (secs) delay between corpse disappearance and respawning
         uint32 m_corpseDelay;                               // (secs) delay between death and corpse disappearance
         uint32 m_aggroDelay;                                // (msecs)delay between respawn and aggro due to movement
+        uint32 m_idleSkippedDiff;                           // (msecs)map update time skipped while idle, given to the next update
+        uint32 m_idleSkippedUpdateId;                       // map update of the last skipped idle update
         float m_respawnradius;
 
         CreatureSubtype m_subtype;                          // set in Creatures subclasses for fast it detect without dynamic_cast use
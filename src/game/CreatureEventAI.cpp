@@ -47,6 +47,21 @@ bool CreatureEventAIHolder::UpdateRepeatTimer(Creature* creature, uint32 repeatM
     return true;
 }
 
+void CreatureEventAIHolder::DecrementTimer(uint32 diff, uint32 phase)
+{
+    if (!Time)
+        return;
+
+    if (Time > diff)
+    {
+        // Do not decrement timers if event cannot trigger in this phase
+        if (!(Event.event_inverse_phase_mask & (1 << phase)))
+            Time -= diff;
+    }
+    else
+        Time = 0;
+}
+
 int CreatureEventAI::Permissible(const Creature* creature)
 {
     if (creature->GetAIName() == "EventAI")
@@ -149,6 +164,8 @@ CreatureEventAI::CreatureEventAI(Creature* c) : CreatureAI(c),
     else
         sLog.outErrorEventAI("EventMap for Creature %u is empty but creature is using CreatureEventAI.", m_creature->GetEntry());
 
+    BuildEventIndexes();
+
     // Handle Spawned Events, also calls Reset()
     JustRespawned();
 }
@@ -180,6 +197,34 @@ inline bool IsTimerBasedEvent(EventAI_Type type)
     }
 }
 
+void CreatureEventAI::BuildEventIndexes()
+{
+    // Count events per type, then place each type's events after the ones of lower types, keeping list order inside a type
+    memset(m_EventTypeOffset, 0, sizeof(m_EventTypeOffset));
+    for (CreatureEventAIList::const_iterator i = m_CreatureEventAIList.begin(); i != m_CreatureEventAIList.end(); ++i)
+        if (i->Event.event_type < EVENT_T_END)
+            ++m_EventTypeOffset[i->Event.event_type + 1];
+
+    for (uint32 type = 1; type <= EVENT_T_END; ++type)
+        m_EventTypeOffset[type] += m_EventTypeOffset[type - 1];
+
+    uint32 nextSlot[EVENT_T_END];
+    memcpy(nextSlot, m_EventTypeOffset, sizeof(nextSlot));
+
+    m_EventsByType.resize(m_EventTypeOffset[EVENT_T_END]);
+    for (uint32 idx = 0; idx < m_CreatureEventAIList.size(); ++idx)
+    {
+        EventAI_Type type = EventAI_Type(m_CreatureEventAIList[idx].Event.event_type);
+        if (type < EVENT_T_END)
+            m_EventsByType[nextSlot[type]++] = idx;
+
+        if (IsTimerBasedEvent(type))
+            m_TimedEvents.push_back(idx);
+    }
+
+    m_CoolingEvents.reserve(m_CreatureEventAIList.size() - m_TimedEvents.size());
+}
+
 bool CreatureEventAI::ProcessEvent(CreatureEventAIHolder& pHolder, Unit* pActionInvoker, Creature* pAIEventSender /*=NULL*/)
 {
     if (!pHolder.Enabled || pHolder.Time)
@@ -454,6 +499,13 @@ bool CreatureEventAI::ProcessEvent(CreatureEventAIHolder& pHolder, Unit* pAction
             break;
     }
 
+    // Other events only need an update while their repeat timer runs
+    if (pHolder.Time && !pHolder.Cooling && !IsTimerBasedEvent(pHolder.Event.event_type))
+    {
+        pHolder.Cooling = true;
+        m_CoolingEvents.push_back(uint32(&pHolder - &m_CreatureEventAIList[0]));
+    }
+
     // Disable non-repeatable events
     if (!(pHolder.Event.event_flags & EFLAG_REPEATABLE))
         pHolder.Enabled = false;
@@ -1030,35 +1082,20 @@ void CreatureEventAI::Reset()
     m_EventDiff = 0;
     m_throwAIEventStep = 0;
 
-    // Reset all events to enabled
-    for (CreatureEventAIList::iterator i = m_CreatureEventAIList.begin(); i != m_CreatureEventAIList.end(); ++i)
+    // Reset all out of combat timers
+    for (uint32 i = m_EventTypeOffset[EVENT_T_TIMER_OOC]; i < m_EventTypeOffset[EVENT_T_TIMER_OOC + 1]; ++i)
     {
-        CreatureEventAI_Event const& event = i->Event;
-        switch (event.event_type)
-        {
-                // Reset all out of combat timers
-            case EVENT_T_TIMER_OOC:
-            {
-                if (i->UpdateRepeatTimer(m_creature, event.timer.initialMin, event.timer.initialMax))
-                    i->Enabled = true;
-                break;
-            }
-            // default:
-            // TODO: enable below code line / verify this is correct to enable events previously disabled (ex. aggro yell), instead of enable this in void Aggro()
-            //i->Enabled = true;
-            //i->Time = 0;
-            // break;
-        }
+        CreatureEventAIHolder& holder = m_CreatureEventAIList[m_EventsByType[i]];
+        if (holder.UpdateRepeatTimer(m_creature, holder.Event.timer.initialMin, holder.Event.timer.initialMax))
+            holder.Enabled = true;
     }
+    // TODO: verify if all other events should be re-enabled here (ex. aggro yell), instead of enable this in void Aggro()
 }
 
 void CreatureEventAI::JustReachedHome()
 {
-    for (CreatureEventAIList::iterator i = m_CreatureEventAIList.begin(); i != m_CreatureEventAIList.end(); ++i)
-    {
-        if (i->Event.event_type == EVENT_T_REACHED_HOME)
-            ProcessEvent(*i);
-    }
+    for (uint32 i = m_EventTypeOffset[EVENT_T_REACHED_HOME]; i < m_EventTypeOffset[EVENT_T_REACHED_HOME + 1]; ++i)
+        ProcessEvent(m_CreatureEventAIList[m_EventsByType[i]]);
 
     Reset();
 }
@@ -1075,11 +1112,8 @@ void CreatureEventAI::EnterEvadeMode()
     m_creature->SetLootRecipient(NULL);
 
     // Handle Evade events
-    for (CreatureEventAIList::iterator i = m_CreatureEventAIList.begin(); i != m_CreatureEventAIList.end(); ++i)
-    {
-        if (i->Event.event_type == EVENT_T_EVADE)
-            ProcessEvent(*i);
-    }
+    for (uint32 i = m_EventTypeOffset[EVENT_T_EVADE]; i < m_EventTypeOffset[EVENT_T_EVADE + 1]; ++i)
+        ProcessEvent(m_CreatureEventAIList[m_EventsByType[i]]);
 }
 
 void CreatureEventAI::JustDied(Unit* killer)
@@ -1097,11 +1131,8 @@ void CreatureEventAI::JustDied(Unit* killer)
         SendAIEventAround(AI_EVENT_JUST_DIED, killer, 0, AIEVENT_DEFAULT_THROW_RADIUS);
 
     // Handle On Death events
-    for (CreatureEventAIList::iterator i = m_CreatureEventAIList.begin(); i != m_CreatureEventAIList.end(); ++i)
-    {
-        if (i->Event.event_type == EVENT_T_DEATH)
-            ProcessEvent(*i, killer);
-    }
+    for (uint32 i = m_EventTypeOffset[EVENT_T_DEATH]; i < m_EventTypeOffset[EVENT_T_DEATH + 1]; ++i)
+        ProcessEvent(m_CreatureEventAIList[m_EventsByType[i]], killer);
 
     // reset phase after any death state events
     m_Phase = 0;
@@ -1112,49 +1143,37 @@ void CreatureEventAI::KilledUnit(Unit* victim)
     if (victim->GetTypeId() != TYPEID_PLAYER)
         return;
 
-    for (CreatureEventAIList::iterator i = m_CreatureEventAIList.begin(); i != m_CreatureEventAIList.end(); ++i)
-    {
-        if (i->Event.event_type == EVENT_T_KILL)
-            ProcessEvent(*i, victim);
-    }
+    for (uint32 i = m_EventTypeOffset[EVENT_T_KILL]; i < m_EventTypeOffset[EVENT_T_KILL + 1]; ++i)
+        ProcessEvent(m_CreatureEventAIList[m_EventsByType[i]], victim);
 }
 
 void CreatureEventAI::JustSummoned(Creature* pUnit)
 {
-    for (CreatureEventAIList::iterator i = m_CreatureEventAIList.begin(); i != m_CreatureEventAIList.end(); ++i)
-    {
-        if (i->Event.event_type == EVENT_T_SUMMONED_UNIT)
-            ProcessEvent(*i, pUnit);
-    }
+    for (uint32 i = m_EventTypeOffset[EVENT_T_SUMMONED_UNIT]; i < m_EventTypeOffset[EVENT_T_SUMMONED_UNIT + 1]; ++i)
+        ProcessEvent(m_CreatureEventAIList[m_EventsByType[i]], pUnit);
 }
 
 void CreatureEventAI::SummonedCreatureJustDied(Creature* pUnit)
 {
-    for (CreatureEventAIList::iterator i = m_CreatureEventAIList.begin(); i != m_CreatureEventAIList.end(); ++i)
-    {
-        if (i->Event.event_type == EVENT_T_SUMMONED_JUST_DIED)
-            ProcessEvent(*i, pUnit);
-    }
+    for (uint32 i = m_EventTypeOffset[EVENT_T_SUMMONED_JUST_DIED]; i < m_EventTypeOffset[EVENT_T_SUMMONED_JUST_DIED + 1]; ++i)
+        ProcessEvent(m_CreatureEventAIList[m_EventsByType[i]], pUnit);
 }
 
 void CreatureEventAI::SummonedCreatureDespawn(Creature* pUnit)
 {
-    for (CreatureEventAIList::iterator i = m_CreatureEventAIList.begin(); i != m_CreatureEventAIList.end(); ++i)
-    {
-        if (i->Event.event_type == EVENT_T_SUMMONED_JUST_DESPAWN)
-            ProcessEvent(*i, pUnit);
-    }
+    for (uint32 i = m_EventTypeOffset[EVENT_T_SUMMONED_JUST_DESPAWN]; i < m_EventTypeOffset[EVENT_T_SUMMONED_JUST_DESPAWN + 1]; ++i)
+        ProcessEvent(m_CreatureEventAIList[m_EventsByType[i]], pUnit);
 }
 
 void CreatureEventAI::ReceiveAIEvent(AIEventType eventType, Creature* pSender, Unit* pInvoker, uint32 /*miscValue*/)
 {
     MANGOS_ASSERT(pSender);
 
-    for (CreatureEventAIList::iterator itr = m_CreatureEventAIList.begin(); itr != m_CreatureEventAIList.end(); ++itr)
+    for (uint32 i = m_EventTypeOffset[EVENT_T_RECEIVE_AI_EVENT]; i < m_EventTypeOffset[EVENT_T_RECEIVE_AI_EVENT + 1]; ++i)
     {
-        if (itr->Event.event_type == EVENT_T_RECEIVE_AI_EVENT &&
-                itr->Event.receiveAIEvent.eventType == eventType && (!itr->Event.receiveAIEvent.senderEntry || itr->Event.receiveAIEvent.senderEntry == pSender->GetEntry()))
-            ProcessEvent(*itr, pInvoker, pSender);
+        CreatureEventAIHolder& holder = m_CreatureEventAIList[m_EventsByType[i]];
+        if (holder.Event.receiveAIEvent.eventType == eventType && (!holder.Event.receiveAIEvent.senderEntry || holder.Event.receiveAIEvent.senderEntry == pSender->GetEntry()))
+            ProcessEvent(holder, pInvoker, pSender);
     }
 }
 
@@ -1210,21 +1229,20 @@ void CreatureEventAI::MoveInLineOfSight(Unit* who)
     // Check for OOC LOS Event
     if (m_HasOOCLoSEvent && !m_creature->getVictim())
     {
-        for (CreatureEventAIList::iterator itr = m_CreatureEventAIList.begin(); itr != m_CreatureEventAIList.end(); ++itr)
+        for (uint32 i = m_EventTypeOffset[EVENT_T_OOC_LOS]; i < m_EventTypeOffset[EVENT_T_OOC_LOS + 1]; ++i)
         {
-            if (itr->Event.event_type == EVENT_T_OOC_LOS)
-            {
-                // can trigger if closer than fMaxAllowedRange
-                float fMaxAllowedRange = (float)itr->Event.ooc_los.maxRange;
+            CreatureEventAIHolder& holder = m_CreatureEventAIList[m_EventsByType[i]];
 
-                // if friendly event && who is not hostile OR hostile event && who is hostile
-                if ((itr->Event.ooc_los.noHostile && !m_creature->IsHostileTo(who)) ||
-                    ((!itr->Event.ooc_los.noHostile) && m_creature->IsHostileTo(who)))
-                {
-                    // if range is ok and we are actually in LOS
-                    if (m_creature->IsWithinDistInMap(who, fMaxAllowedRange) && m_creature->IsWithinLOSInMap(who))
-                        ProcessEvent(*itr, who);
-                }
+            // can trigger if closer than fMaxAllowedRange
+            float fMaxAllowedRange = (float)holder.Event.ooc_los.maxRange;
+
+            // if friendly event && who is not hostile OR hostile event && who is hostile
+            if ((holder.Event.ooc_los.noHostile && !m_creature->IsHostileTo(who)) ||
+                ((!holder.Event.ooc_los.noHostile) && m_creature->IsHostileTo(who)))
+            {
+                // if range is ok and we are actually in LOS
+                if (m_creature->IsWithinDistInMap(who, fMaxAllowedRange) && m_creature->IsWithinLOSInMap(who))
+                    ProcessEvent(holder, who);
             }
         }
     }
@@ -1257,12 +1275,14 @@ void CreatureEventAI::MoveInLineOfSight(Unit* who)
 
 void CreatureEventAI::SpellHit(Unit* pUnit, const SpellEntry* pSpell)
 {
-    for (CreatureEventAIList::iterator i = m_CreatureEventAIList.begin(); i != m_CreatureEventAIList.end(); ++i)
-        if (i->Event.event_type == EVENT_T_SPELLHIT)
-            // If spell id matches (or no spell id) & if spell school matches (or no spell school)
-            if (!i->Event.spell_hit.spellId || pSpell->Id == i->Event.spell_hit.spellId)
-                if (pSpell->SchoolMask & i->Event.spell_hit.schoolMask)
-                    ProcessEvent(*i, pUnit);
+    for (uint32 i = m_EventTypeOffset[EVENT_T_SPELLHIT]; i < m_EventTypeOffset[EVENT_T_SPELLHIT + 1]; ++i)
+    {
+        CreatureEventAIHolder& holder = m_CreatureEventAIList[m_EventsByType[i]];
+        // If spell id matches (or no spell id) & if spell school matches (or no spell school)
+        if (!holder.Event.spell_hit.spellId || pSpell->Id == holder.Event.spell_hit.spellId)
+            if (pSpell->SchoolMask & holder.Event.spell_hit.schoolMask)
+                ProcessEvent(holder, pUnit);
+    }
 }
 
 void CreatureEventAI::UpdateAI(const uint32 diff)
@@ -1275,28 +1295,32 @@ void CreatureEventAI::UpdateAI(const uint32 diff)
     {
         m_EventDiff += diff;
 
-        // Check for time based events
-        for (CreatureEventAIList::iterator i = m_CreatureEventAIList.begin(); i != m_CreatureEventAIList.end(); ++i)
+        // Decrement repeat timers of other events, they are processed by their own hooks
+        for (uint32 i = 0; i < m_CoolingEvents.size();)
         {
-            // Decrement Timers
-            if (i->Time)
+            CreatureEventAIHolder& holder = m_CreatureEventAIList[m_CoolingEvents[i]];
+            holder.DecrementTimer(m_EventDiff, m_Phase);
+            if (holder.Time)
+                ++i;
+            else
             {
-                if (i->Time > m_EventDiff)
-                {
-                    // Do not decrement timers if event cannot trigger in this phase
-                    if (!(i->Event.event_inverse_phase_mask & (1 << m_Phase)))
-                        i->Time -= m_EventDiff;
-                }
-                else
-                    i->Time = 0;
+                holder.Cooling = false;
+                m_CoolingEvents[i] = m_CoolingEvents.back();
+                m_CoolingEvents.pop_back();
             }
+        }
+
+        // Check for time based events
+        for (CreatureEventAIIndexList::const_iterator itr = m_TimedEvents.begin(); itr != m_TimedEvents.end(); ++itr)
+        {
+            CreatureEventAIHolder& holder = m_CreatureEventAIList[*itr];
+            holder.DecrementTimer(m_EventDiff, m_Phase);
 
             // Skip processing of events that have time remaining or are disabled
-            if (!(i->Enabled) || i->Time)
+            if (!holder.Enabled || holder.Time)
                 continue;
 
-            if (IsTimerBasedEvent(i->Event.event_type))
-                ProcessEvent(*i);
+            ProcessEvent(holder);
         }
 
         m_EventDiff = 0;
@@ -1436,19 +1460,17 @@ void CreatureEventAI::DoFindFriendlyMissingBuff(std::list<Creature*>& _list, flo
 
 void CreatureEventAI::ReceiveEmote(Player* pPlayer, uint32 text_emote)
 {
-    for (CreatureEventAIList::iterator itr = m_CreatureEventAIList.begin(); itr != m_CreatureEventAIList.end(); ++itr)
+    for (uint32 i = m_EventTypeOffset[EVENT_T_RECEIVE_EMOTE]; i < m_EventTypeOffset[EVENT_T_RECEIVE_EMOTE + 1]; ++i)
     {
-        if (itr->Event.event_type == EVENT_T_RECEIVE_EMOTE)
-        {
-            if (itr->Event.receive_emote.emoteId != text_emote)
-                return;
+        CreatureEventAIHolder& holder = m_CreatureEventAIList[m_EventsByType[i]];
+        if (holder.Event.receive_emote.emoteId != text_emote)
+            return;
 
-            PlayerCondition pcon(0, itr->Event.receive_emote.condition, itr->Event.receive_emote.conditionValue1, itr->Event.receive_emote.conditionValue2);
-            if (pcon.Meets(pPlayer, m_creature->GetMap(), m_creature, CONDITION_FROM_EVENTAI))
-            {
-                DEBUG_FILTER_LOG(LOG_FILTER_AI_AND_MOVEGENSS, "CreatureEventAI: ReceiveEmote CreatureEventAI: Condition ok, processing");
-                ProcessEvent(*itr, pPlayer);
-            }
+        PlayerCondition pcon(0, holder.Event.receive_emote.condition, holder.Event.receive_emote.conditionValue1, holder.Event.receive_emote.conditionValue2);
+        if (pcon.Meets(pPlayer, m_creature->GetMap(), m_creature, CONDITION_FROM_EVENTAI))
+        {
+            DEBUG_FILTER_LOG(LOG_FILTER_AI_AND_MOVEGENSS, "CreatureEventAI: ReceiveEmote CreatureEventAI: Condition ok, processing");
+            ProcessEvent(holder, pPlayer);
         }
     }
 }
@@ -601,14 +601,16 @@ typedef UNORDERED_MAP<uint32, CreatureEventAI_Summon> CreatureEventAI_Summon_Map
 
 struct CreatureEventAIHolder
 {
-    CreatureEventAIHolder(CreatureEventAI_Event p) : Event(p), Time(0), Enabled(true) {}
+    CreatureEventAIHolder(CreatureEventAI_Event p) : Event(p), Time(0), Enabled(true), Cooling(false) {}
 
     CreatureEventAI_Event Event;
     uint32 Time;
     bool Enabled;
+    bool Cooling;                                           // not timer based and listed in m_CoolingEvents
 
     // helper
     bool UpdateRepeatTimer(Creature* creature, uint32 repeatMin, uint32 repeatMax);
+    void DecrementTimer(uint32 diff, uint32 phase);
 };
 
 class MANGOS_DLL_SPEC CreatureEventAI : public CreatureAI
@@ -652,6 +654,7 @@ class MANGOS_DLL_SPEC CreatureEventAI : public CreatureAI
         inline Unit* GetTargetByType(uint32 Target, Unit* pActionInvoker, Creature* pAIEventSender, bool& isError, uint32 forSpellId = 0, uint32 selectFlags = 0);
 
         bool SpawnedEventConditionsCheck(CreatureEventAI_Event const& event);
+        void BuildEventIndexes();
 
         Unit* DoSelectLowestHpFriendly(float range, uint32 MinHPDiff);
         void DoFindFriendlyMissingBuff(std::list<Creature*>& _list, float range, uint32 spellid);
@@ -665,6 +668,13 @@ class MANGOS_DLL_SPEC CreatureEventAI : public CreatureAI
         typedef std::vector<CreatureEventAIHolder> CreatureEventAIList;
         CreatureEventAIList m_CreatureEventAIList;          // Holder for events (stores enabled, time, and eventid)
 
+        // Indexes into m_CreatureEventAIList, built once at AI creation, list order is kept inside each index
+        typedef std::vector<uint32> CreatureEventAIIndexList;
+        CreatureEventAIIndexList m_EventsByType;            // Grouped by event type
+        uint32 m_EventTypeOffset[EVENT_T_END + 1];          // Events of type t are m_EventsByType[m_EventTypeOffset[t] .. m_EventTypeOffset[t + 1])
+        CreatureEventAIIndexList m_TimedEvents;             // Timer based events, checked at each event update
+        CreatureEventAIIndexList m_CoolingEvents;           // Other events with a running repeat timer
+
         uint8  m_Phase;                                     // Current phase, max 32 phases
         bool   m_MeleeEnabled;                              // If we allow melee auto attack
         bool   m_HasOOCLoSEvent;                            // Cache if a OOC-LoS Event exists
@@ -690,6 +690,23 @@ void GameEventMgr::ApplyNewEvent(uint16 event_id, bool resume)
         SendEventMails(event_id);
 }
 
+/// Pool members of negative events change their pool state, which is applied on the maps of the
+/// top pool. Queue them with that map, so they keep their order with the pool spawn and despawn.
+template<typename T>
+static uint32 GetTransitionMapId(int16 event_id, uint32 db_guid, uint32 mapId)
+{
+    if (event_id < 0)
+    {
+        if (uint16 topPoolId = sPoolMgr.IsPartOfTopPool<T>(db_guid))
+        {
+            if (MapEntry const* mapEntry = sPoolMgr.GetPoolTemplate(topPoolId).mapEntry)
+                return mapEntry->MapID;
+        }
+    }
+
+    return mapId;
+}
+
 void GameEventMgr::GameEventSpawn(int16 event_id)
 {
     int32 internal_event_id = mGameEvent.size() + event_id - 1;
@@ -701,28 +718,8 @@ void GameEventMgr::GameEventSpawn(int16 event_id)
     }
 
     for (GuidList::iterator itr = mGameEventCreatureGuids[internal_event_id].begin(); itr != mGameEventCreatureGuids[internal_event_id].end(); ++itr)
-    {
-        // Add to correct cell
-        CreatureData const* data = sObjectMgr.GetCreatureData(*itr);
-        if (data)
-        {
-            // negative event id for pool element meaning allow be used in next pool spawn
-            if (event_id < 0)
-            {
-                if (uint16 pool_id = sPoolMgr.IsPartOfAPool<Creature>(*itr))
-                {
-                    // will have chance at next pool update
-                    sPoolMgr.SetExcludeObject<Creature>(pool_id, *itr, false);
-                    sPoolMgr.UpdatePoolInMaps<Creature>(pool_id);
-                    continue;
-                }
-            }
-
-            sObjectMgr.AddCreatureToGrid(*itr, data);
-
-            Creature::SpawnInMaps(*itr, data);
-        }
-    }
+        if (CreatureData const* data = sObjectMgr.GetCreatureData(*itr))
+            AddTransition(GetTransitionMapId<Creature>(event_id, *itr, data->mapid), GameEventTransition(GAME_EVENT_SPAWN_CREATURE, event_id, *itr));
 
     if (internal_event_id < 0 || (size_t)internal_event_id >= mGameEventGameobjectGuids.size())
     {
@@ -731,28 +728,8 @@ void GameEventMgr::GameEventSpawn(int16 event_id)
     }
 
     for (GuidList::iterator itr = mGameEventGameobjectGuids[internal_event_id].begin(); itr != mGameEventGameobjectGuids[internal_event_id].end(); ++itr)
-    {
-        // Add to correct cell
-        GameObjectData const* data = sObjectMgr.GetGOData(*itr);
-        if (data)
-        {
-            // negative event id for pool element meaning allow be used in next pool spawn
-            if (event_id < 0)
-            {
-                if (uint16 pool_id = sPoolMgr.IsPartOfAPool<GameObject>(*itr))
-                {
-                    // will have chance at next pool update
-                    sPoolMgr.SetExcludeObject<GameObject>(pool_id, *itr, false);
-                    sPoolMgr.UpdatePoolInMaps<GameObject>(pool_id);
-                    continue;
-                }
-            }
-
-            sObjectMgr.AddGameobjectToGrid(*itr, data);
-
-            GameObject::SpawnInMaps(*itr, data);
-        }
-    }
+        if (GameObjectData const* data = sObjectMgr.GetGOData(*itr))
+            AddTransition(GetTransitionMapId<GameObject>(event_id, *itr, data->mapid), GameEventTransition(GAME_EVENT_SPAWN_GAMEOBJECT, event_id, *itr));
 
     if (event_id > 0)
     {
@@ -763,7 +740,14 @@ void GameEventMgr::GameEventSpawn(int16 event_id)
         }
 
         for (IdList::iterator itr = mGameEventSpawnPoolIds[event_id].begin(); itr != mGameEventSpawnPoolIds[event_id].end(); ++itr)
-            sPoolMgr.SpawnPoolInMaps(*itr, true);
+        {
+            // pool without spawns, nothing to do
+            MapEntry const* mapEntry = sPoolMgr.GetPoolTemplate(*itr).mapEntry;
+            if (!mapEntry)
+                continue;
+
+            AddTransition(mapEntry->MapID, GameEventTransition(GAME_EVENT_SPAWN_POOL, event_id, *itr));
+        }
     }
 }
 
@@ -778,28 +762,8 @@ void GameEventMgr::GameEventUnspawn(int16 event_id)
     }
 
     for (GuidList::iterator itr = mGameEventCreatureGuids[internal_event_id].begin(); itr != mGameEventCreatureGuids[internal_event_id].end(); ++itr)
-    {
-        // Remove the creature from grid
         if (CreatureData const* data = sObjectMgr.GetCreatureData(*itr))
-        {
-            // negative event id for pool element meaning unspawn in pool and exclude for next spawns
-            if (event_id < 0)
-            {
-                if (uint16 poolid = sPoolMgr.IsPartOfAPool<Creature>(*itr))
-                {
-                    sPoolMgr.SetExcludeObject<Creature>(poolid, *itr, true);
-                    sPoolMgr.UpdatePoolInMaps<Creature>(poolid, *itr);
-                    continue;
-                }
-            }
-
-            // Remove spawn data
-            sObjectMgr.RemoveCreatureFromGrid(*itr, data);
-
-            // Remove spawned cases
-            Creature::AddToRemoveListInMaps(*itr, data);
-        }
-    }
+            AddTransition(GetTransitionMapId<Creature>(event_id, *itr, data->mapid), GameEventTransition(GAME_EVENT_UNSPAWN_CREATURE, event_id, *itr));
 
     if (internal_event_id < 0 || (size_t)internal_event_id >= mGameEventGameobjectGuids.size())
     {
@@ -808,28 +772,8 @@ void GameEventMgr::GameEventUnspawn(int16 event_id)
     }
 
     for (GuidList::iterator itr = mGameEventGameobjectGuids[internal_event_id].begin(); itr != mGameEventGameobjectGuids[internal_event_id].end(); ++itr)
-    {
-        // Remove the gameobject from grid
         if (GameObjectData const* data = sObjectMgr.GetGOData(*itr))
-        {
-            // negative event id for pool element meaning unspawn in pool and exclude for next spawns
-            if (event_id < 0)
-            {
-                if (uint16 poolid = sPoolMgr.IsPartOfAPool<GameObject>(*itr))
-                {
-                    sPoolMgr.SetExcludeObject<GameObject>(poolid, *itr, true);
-                    sPoolMgr.UpdatePoolInMaps<GameObject>(poolid, *itr);
-                    continue;
-                }
-            }
-
-            // Remove spawn data
-            sObjectMgr.RemoveGameobjectFromGrid(*itr, data);
-
-            // Remove spawned cases
-            GameObject::AddToRemoveListInMaps(*itr, data);
-        }
-    }
+            AddTransition(GetTransitionMapId<GameObject>(event_id, *itr, data->mapid), GameEventTransition(GAME_EVENT_UNSPAWN_GAMEOBJECT, event_id, *itr));
 
     if (event_id > 0)
     {
@@ -841,7 +785,12 @@ void GameEventMgr::GameEventUnspawn(int16 event_id)
 
         for (IdList::iterator itr = mGameEventSpawnPoolIds[event_id].begin(); itr != mGameEventSpawnPoolIds[event_id].end(); ++itr)
         {
-            sPoolMgr.DespawnPoolInMaps(*itr);
+            // pool without spawns, nothing to do
+            MapEntry const* mapEntry = sPoolMgr.GetPoolTemplate(*itr).mapEntry;
+            if (!mapEntry)
+                continue;
+
+            AddTransition(mapEntry->MapID, GameEventTransition(GAME_EVENT_DESPAWN_POOL, event_id, *itr));
         }
     }
 }
@@ -897,14 +846,169 @@ void GameEventMgr::UpdateCreatureData(int16 event_id, bool activate)
 {
     for (GameEventCreatureDataList::iterator itr = mGameEventCreatureData[event_id].begin(); itr != mGameEventCreatureData[event_id].end(); ++itr)
     {
-        // Remove the creature from grid
         CreatureData const* data = sObjectMgr.GetCreatureData(itr->first);
         if (!data)
             continue;
 
-        // Update if spawned
-        GameEventUpdateCreatureDataInMapsWorker worker(data->GetObjectGuid(itr->first), data, &itr->second, activate);
-        sMapMgr.DoForAllMapsWithMapId(data->mapid, worker);
+        AddTransition(data->mapid, GameEventTransition(GAME_EVENT_UPDATE_CREATURE_DATA, event_id, itr->first, &itr->second, activate));
+    }
+}
+
+void GameEventMgr::AddTransition(uint32 mapId, GameEventTransition const& transition)
+{
+    // startup has no players to stall, and already queued changes of the map must keep their order
+    if (!m_IsGameEventsInit || (!sWorld.getConfig(CONFIG_UINT32_EVENT_SPAWN_PER_TICK) && m_transitions.empty()))
+    {
+        ApplyTransition(transition);
+        return;
+    }
+
+    m_transitions[mapId].push_back(transition);
+}
+
+void GameEventMgr::UpdateTransitions()
+{
+    if (m_transitions.empty())
+        return;
+
+    uint32 budget = sWorld.getConfig(CONFIG_UINT32_EVENT_SPAWN_PER_TICK);
+
+    for (GameEventTransitionMap::iterator itr = m_transitions.begin(); itr != m_transitions.end();)
+    {
+        GameEventTransitionQueue& queue = itr->second;
+        for (uint32 count = 0; !queue.empty() && (!budget || count < budget); ++count)
+        {
+            ApplyTransition(queue.front());
+            queue.pop_front();
+        }
+
+        if (queue.empty())
+        {
+            DEBUG_LOG("GameEventMgr: all event spawn changes applied for map %u", itr->first);
+            m_transitions.erase(itr++);
+        }
+        else
+            ++itr;
+    }
+}
+
+void GameEventMgr::ApplyTransition(GameEventTransition const& transition)
+{
+    switch (transition.type)
+    {
+        case GAME_EVENT_SPAWN_CREATURE:
+        {
+            CreatureData const* data = sObjectMgr.GetCreatureData(transition.id);
+            if (!data)
+                break;
+
+            // negative event id for pool element meaning allow be used in next pool spawn
+            if (transition.eventId < 0)
+            {
+                if (uint16 pool_id = sPoolMgr.IsPartOfAPool<Creature>(transition.id))
+                {
+                    // will have chance at next pool update
+                    sPoolMgr.SetExcludeObject<Creature>(pool_id, transition.id, false);
+                    sPoolMgr.UpdatePoolInMaps<Creature>(pool_id);
+                    break;
+                }
+            }
+
+            // Add to correct cell
+            sObjectMgr.AddCreatureToGrid(transition.id, data);
+
+            Creature::SpawnInMaps(transition.id, data);
+            break;
+        }
+        case GAME_EVENT_UNSPAWN_CREATURE:
+        {
+            CreatureData const* data = sObjectMgr.GetCreatureData(transition.id);
+            if (!data)
+                break;
+
+            // negative event id for pool element meaning unspawn in pool and exclude for next spawns
+            if (transition.eventId < 0)
+            {
+                if (uint16 poolid = sPoolMgr.IsPartOfAPool<Creature>(transition.id))
+                {
+                    sPoolMgr.SetExcludeObject<Creature>(poolid, transition.id, true);
+                    sPoolMgr.UpdatePoolInMaps<Creature>(poolid, transition.id);
+                    break;
+                }
+            }
+
+            // Remove spawn data
+            sObjectMgr.RemoveCreatureFromGrid(transition.id, data);
+
+            // Remove spawned cases
+            Creature::AddToRemoveListInMaps(transition.id, data);
+            break;
+        }
+        case GAME_EVENT_SPAWN_GAMEOBJECT:
+        {
+            GameObjectData const* data = sObjectMgr.GetGOData(transition.id);
+            if (!data)
+                break;
+
+            // negative event id for pool element meaning allow be used in next pool spawn
+            if (transition.eventId < 0)
+            {
+                if (uint16 pool_id = sPoolMgr.IsPartOfAPool<GameObject>(transition.id))
+                {
+                    // will have chance at next pool update
+                    sPoolMgr.SetExcludeObject<GameObject>(pool_id, transition.id, false);
+                    sPoolMgr.UpdatePoolInMaps<GameObject>(pool_id);
+                    break;
+                }
+            }
+
+            // Add to correct cell
+            sObjectMgr.AddGameobjectToGrid(transition.id, data);
+
+            GameObject::SpawnInMaps(transition.id, data);
+            break;
+        }
+        case GAME_EVENT_UNSPAWN_GAMEOBJECT:
+        {
+            GameObjectData const* data = sObjectMgr.GetGOData(transition.id);
+            if (!data)
+                break;
+
+            // negative event id for pool element meaning unspawn in pool and exclude for next spawns
+            if (transition.eventId < 0)
+            {
+                if (uint16 poolid = sPoolMgr.IsPartOfAPool<GameObject>(transition.id))
+                {
+                    sPoolMgr.SetExcludeObject<GameObject>(poolid, transition.id, true);
+                    sPoolMgr.UpdatePoolInMaps<GameObject>(poolid, transition.id);
+                    break;
+                }
+            }
+
+            // Remove spawn data
+            sObjectMgr.RemoveGameobjectFromGrid(transition.id, data);
+
+            // Remove spawned cases
+            GameObject::AddToRemoveListInMaps(transition.id, data);
+            break;
+        }
+        case GAME_EVENT_SPAWN_POOL:
+            sPoolMgr.SpawnPoolInMaps(transition.id, true);
+            break;
+        case GAME_EVENT_DESPAWN_POOL:
+            sPoolMgr.DespawnPoolInMaps(transition.id);
+            break;
+        case GAME_EVENT_UPDATE_CREATURE_DATA:
+        {
+            CreatureData const* data = sObjectMgr.GetCreatureData(transition.id);
+            if (!data)
+                break;
+
+            // Update if spawned
+            GameEventUpdateCreatureDataInMapsWorker worker(data->GetObjectGuid(transition.id), data, transition.creatureData, transition.activate);
+            sMapMgr.DoForAllMapsWithMapId(data->mapid, worker);
+            break;
+        }
     }
 }
 
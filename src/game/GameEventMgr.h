@@ -24,6 +24,8 @@
 #include "Platform/Define.h"
 #include "Policies/Singleton.h"
 
+#include <deque>
+
 #define max_ge_check_delay 86400                            // 1 day in seconds
 
 class Creature;
@@ -66,6 +68,30 @@ struct GameEventMail
 
 typedef std::pair<uint32, GameEventCreatureData> GameEventCreatureDataPair;
 
+enum GameEventTransitionType
+{
+    GAME_EVENT_SPAWN_CREATURE,
+    GAME_EVENT_UNSPAWN_CREATURE,
+    GAME_EVENT_SPAWN_GAMEOBJECT,
+    GAME_EVENT_UNSPAWN_GAMEOBJECT,
+    GAME_EVENT_SPAWN_POOL,
+    GAME_EVENT_DESPAWN_POOL,
+    GAME_EVENT_UPDATE_CREATURE_DATA
+};
+
+// One spawn change of a started or stopped event, applied in order per map
+struct GameEventTransition
+{
+    GameEventTransition(GameEventTransitionType _type, int16 _eventId, uint32 _id, GameEventCreatureData* _creatureData = NULL, bool _activate = false)
+        : type(_type), eventId(_eventId), id(_id), creatureData(_creatureData), activate(_activate) {}
+
+    GameEventTransitionType type;
+    int16 eventId;                                          // negative for the spawns of inactive events
+    uint32 id;                                              // db guid or pool id
+    GameEventCreatureData* creatureData;                    // data to apply for GAME_EVENT_UPDATE_CREATURE_DATA
+    bool activate;                                          // GAME_EVENT_UPDATE_CREATURE_DATA: apply creatureData at event start, else restore at event stop
+};
+
 class GameEventMgr
 {
     public:
@@ -86,6 +112,7 @@ class GameEventMgr
         uint32 Initialize();
         void StartEvent(uint16 event_id, bool overwrite = false, bool resume = false);
         void StopEvent(uint16 event_id, bool overwrite = false);
+        void UpdateTransitions();                           // called each world tick, applies queued spawn changes
         template<typename T>
         int16 GetGameEventId(uint32 guid_or_poolid);
 
@@ -99,6 +126,8 @@ class GameEventMgr
         void UpdateEventQuests(uint16 event_id, bool activate);
         void UpdateWorldStates(uint16 event_id, bool activate);
         void SendEventMails(int16 event_id);
+        void AddTransition(uint32 mapId, GameEventTransition const& transition);
+        void ApplyTransition(GameEventTransition const& transition);
     protected:
         typedef std::list<uint32> GuidList;
         typedef std::list<uint16> IdList;
@@ -126,6 +155,10 @@ class GameEventMgr
         GameEventDataMap  mGameEvent;
         ActiveEvents m_ActiveEvents;
         bool m_IsGameEventsInit;
+
+        typedef std::deque<GameEventTransition> GameEventTransitionQueue;
+        typedef std::map<uint32 /*mapId*/, GameEventTransitionQueue> GameEventTransitionMap;
+        GameEventTransitionMap m_transitions;               // spawn changes waiting for their map budget
 };
 
 #define sGameEventMgr MaNGOS::Singleton<GameEventMgr>::Instance()
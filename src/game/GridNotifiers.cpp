@@ -127,6 +127,26 @@ void MessageDelivererExcept::Visit(CameraMapType& m)
     }
 }
 
+void MovementRelayDeliverer::Visit(CameraMapType& m)
+{
+    for (CameraMapType::iterator iter = m.begin(); iter != m.end(); ++iter)
+    {
+        Player* owner = iter->getSource()->GetOwner();
+
+        if (!owner->InSamePhase(&i_mover) || owner == i_skipped_receiver)
+            continue;
+
+        if (!i_toFar && !iter->getSource()->GetBody()->IsWithinDist(&i_mover, i_nearDist, false))
+        {
+            ++i_farSkipped;
+            continue;
+        }
+
+        if (WorldSession* session = owner->GetSession())
+            session->SendPacket(i_message);
+    }
+}
+
 void ObjectMessageDeliverer::Visit(CameraMapType& m)
 {
     for (CameraMapType::iterator iter = m.begin(); iter != m.end(); ++iter)
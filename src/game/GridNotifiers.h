@@ -77,6 +77,23 @@ namespace MaNGOS
         template<class SKIP> void Visit(GridRefManager<SKIP>&) {}
     };
 
+    // Relay of a mover's position update, observers farther than i_nearDist get it only when i_toFar is set
+    struct MovementRelayDeliverer
+    {
+        WorldObject const& i_mover;
+        WorldPacket*  i_message;
+        Player const* i_skipped_receiver;
+        float         i_nearDist;
+        bool          i_toFar;
+        uint32        i_farSkipped;
+
+        MovementRelayDeliverer(WorldObject const& mover, WorldPacket* msg, Player const* skipped, float nearDist, bool toFar)
+            : i_mover(mover), i_message(msg), i_skipped_receiver(skipped), i_nearDist(nearDist), i_toFar(toFar), i_farSkipped(0) {}
+
+        void Visit(CameraMapType& m);
+        template<class SKIP> void Visit(GridRefManager<SKIP>&) {}
+    };
+
     struct MANGOS_DLL_DECL ObjectMessageDeliverer
     {
         uint32 i_phaseMask;
@@ -114,7 +131,14 @@ namespace MaNGOS
     struct MANGOS_DLL_DECL ObjectUpdater
     {
         uint32 i_timeDiff;
-        explicit ObjectUpdater(const uint32& diff) : i_timeDiff(diff) {}
+        uint32 i_updateId;                                  // Map update counter, see Creature::DropStaleIdleSkippedDiff
+        uint32 i_idleInterval;                              // idle creatures are updated once per interval, 0 for every update
+        uint32 i_creatureCount[MAX_CREATURE_UPDATE_TIER];
+        ObjectUpdater(const uint32& diff, uint32 updateId, uint32 idleInterval = 0) : i_timeDiff(diff), i_updateId(updateId), i_idleInterval(idleInterval)
+        {
+            for (int i = 0; i < MAX_CREATURE_UPDATE_TIER; ++i)
+                i_creatureCount[i] = 0;
+        }
         template<class T> void Visit(GridRefManager<T>& m);
         void Visit(PlayerMapType&) {}
         void Visit(CorpseMapType&) {}
@@ -43,8 +43,26 @@ inline void MaNGOS::ObjectUpdater::Visit(CreatureMapType& m)
 {
     for (CreatureMapType::iterator iter = m.begin(); iter != m.end(); ++iter)
     {
-        WorldObject::UpdateHelper helper(iter->getSource());
-        helper.Update(i_timeDiff);
+        Creature* creature = iter->getSource();
+
+        creature->DropStaleIdleSkippedDiff(i_updateId);
+
+        if (i_idleInterval && creature->CanUseIdleUpdateRate())
+        {
+            if (!creature->IsIdleUpdateDue(i_idleInterval))
+            {
+                creature->DeferIdleUpdate(i_timeDiff, i_updateId);
+                ++i_creatureCount[CREATURE_UPDATE_TIER_DEFERRED];
+                continue;
+            }
+
+            ++i_creatureCount[CREATURE_UPDATE_TIER_IDLE];
+        }
+        else
+            ++i_creatureCount[CREATURE_UPDATE_TIER_FULL];
+
+        WorldObject::UpdateHelper helper(creature);
+        helper.Update(creature->TakeIdleSkippedDiff(i_timeDiff));
     }
 }
 
@@ -232,6 +232,9 @@ bool Guild::AddMember(ObjectGuid plGuid, uint32 plRank)
     CharacterDatabase.PExecute("INSERT INTO guild_member (guildid,guid,rank,pnote,offnote) VALUES ('%u', '%u', '%u','%s','%s')",
                                m_Id, lowguid, newmember.RankId, dbPnote.c_str(), dbOFFnote.c_str());
 
+    // the guild is shown at the character screen
+    sWorld.InvalidateCharEnum(newmember.accountId);
+
     // If player not in game data in data field will be loaded from guild tables, no need to update it!!
     if (pl)
     {
@@ -544,6 +547,8 @@ bool Guild::DelMember(ObjectGuid guid, bool isDisbanding)
         }
     }
 
+    MemberList::iterator slotItr = members.find(lowguid);
+    uint32 accountId = slotItr != members.end() ? slotItr->second.accountId : 0;
     members.erase(lowguid);
 
     Player* player = sObjectMgr.GetPlayer(guid);
@@ -556,6 +561,9 @@ bool Guild::DelMember(ObjectGuid guid, bool isDisbanding)
 
     CharacterDatabase.PExecute("DELETE FROM guild_member WHERE guid = '%u'", lowguid);
 
+    if (accountId)
+        sWorld.InvalidateCharEnum(accountId);
+
     if (!isDisbanding)
         UpdateAccountsNumber();
 
@@ -3964,6 +3964,7 @@ bool ChatHandler::HandleCharacterRenameCommand(char* args)
 
         PSendSysMessage(LANG_RENAME_PLAYER_GUID, oldNameLink.c_str(), target_guid.GetCounter());
         CharacterDatabase.PExecute("UPDATE characters SET at_login = at_login | '1' WHERE guid = '%u'", target_guid.GetCounter());
+        sWorld.InvalidateCharEnumOf(target_guid);
     }
 
     return true;
@@ -3990,6 +3991,7 @@ bool ChatHandler::HandleCharacterCustomizeCommand(char* args)
 
         PSendSysMessage(LANG_CUSTOMIZE_PLAYER_GUID, oldNameLink.c_str(), target_guid.GetCounter());
         CharacterDatabase.PExecute("UPDATE characters SET at_login = at_login | '8' WHERE guid = '%u'", target_guid.GetCounter());
+        sWorld.InvalidateCharEnumOf(target_guid);
     }
 
     return true;
@@ -57,6 +57,7 @@
 #include "DBCEnums.h"
 #include "AuctionHouseBot/AuctionHouseBot.h"
 #include "SQLStorages.h"
+#include "NameLookupMgr.h"
 
 static uint32 ahbotQualityIds[MAX_AUCTION_QUALITY] =
 {
@@ -483,6 +484,7 @@ bool ChatHandler::HandleReloadQuestTemplateCommand(char* /*args*/)
 {
     sLog.outString("Re-Loading Quest Templates...");
     sObjectMgr.LoadQuests();
+    sNameLookupMgr.Clear(NAME_LOOKUP_QUEST);
     SendGlobalSysMessage("DB table `quest_template` (quest definitions) reloaded.");
 
     /// dependent also from `gameobject` but this table not reloaded anyway
@@ -1055,6 +1057,7 @@ bool ChatHandler::HandleReloadLocalesCreatureCommand(char* /*args*/)
 {
     sLog.outString("Re-Loading Locales Creature ...");
     sObjectMgr.LoadCreatureLocales();
+    sNameLookupMgr.Clear(NAME_LOOKUP_CREATURE);
     SendGlobalSysMessage("DB table `locales_creature` reloaded.");
     return true;
 }
@@ -1063,6 +1066,7 @@ bool ChatHandler::HandleReloadLocalesGameobjectCommand(char* /*args*/)
 {
     sLog.outString("Re-Loading Locales Gameobject ... ");
     sObjectMgr.LoadGameObjectLocales();
+    sNameLookupMgr.Clear(NAME_LOOKUP_GAMEOBJECT);
     SendGlobalSysMessage("DB table `locales_gameobject` reloaded.");
     return true;
 }
@@ -1079,6 +1083,7 @@ bool ChatHandler::HandleReloadLocalesItemCommand(char* /*args*/)
 {
     sLog.outString("Re-Loading Locales Item ... ");
     sObjectMgr.LoadItemLocales();
+    sNameLookupMgr.Clear(NAME_LOOKUP_ITEM);
     SendGlobalSysMessage("DB table `locales_item` reloaded.");
     return true;
 }
@@ -1111,6 +1116,7 @@ bool ChatHandler::HandleReloadLocalesQuestCommand(char* /*args*/)
 {
     sLog.outString("Re-Loading Locales Quest ... ");
     sObjectMgr.LoadQuestLocales();
+    sNameLookupMgr.Clear(NAME_LOOKUP_QUEST);
     SendGlobalSysMessage("DB table `locales_quest` reloaded.");
     return true;
 }
@@ -3156,21 +3162,14 @@ bool ChatHandler::HandleLookupItemCommand(char* args)
 
     uint32 counter = 0;
 
+    int loc_idx = GetSessionDbLocaleIndex();
+
     // Search in `item_template`
-    for (uint32 id = 0; id < sItemStorage.GetMaxEntry(); ++id)
+    NameLookupMatches matches;
+    sNameLookupMgr.Find(NAME_LOOKUP_ITEM, loc_idx, wnamepart, matches);
+    for (NameLookupMatches::const_iterator itr = matches.begin(); itr != matches.end(); ++itr)
     {
-        ItemPrototype const* pProto = sItemStorage.LookupEntry<ItemPrototype >(id);
-        if (!pProto)
-            continue;
-
-        int loc_idx = GetSessionDbLocaleIndex();
-
-        std::string name;                                   // "" for let later only single time check default locale name directly
-        sObjectMgr.GetItemLocaleStrings(id, loc_idx, &name);
-        if ((name.empty() || !Utf8FitTo(name, wnamepart)) && !Utf8FitTo(pProto->Name1, wnamepart))
-            continue;
-
-        ShowItemListHelper(id, loc_idx, pl);
+        ShowItemListHelper(itr->first, loc_idx, pl);
         ++counter;
     }
 
@@ -3385,39 +3384,18 @@ bool ChatHandler::HandleLookupSpellCommand(char* args)
     uint32 counter = 0;                                     // Counter for figure out that we found smth.
 
     // Search in Spell.dbc
-    for (uint32 id = 0; id < sSpellStore.GetNumRows(); ++id)
+    NameLookupMatches matches;
+    sNameLookupMgr.Find(NAME_LOOKUP_SPELL, GetSessionDbcLocale(), wnamepart, matches);
+    for (NameLookupMatches::const_iterator itr = matches.begin(); itr != matches.end(); ++itr)
     {
-        SpellEntry const* spellInfo = sSpellStore.LookupEntry(id);
-        if (spellInfo)
-        {
-            int loc = GetSessionDbcLocale();
-            std::string name = spellInfo->SpellName[loc];
-            if (name.empty())
-                continue;
+        SpellEntry const* spellInfo = sSpellStore.LookupEntry(itr->first);
 
-            if (!Utf8FitTo(name, wnamepart))
-            {
-                loc = 0;
-                for (; loc < MAX_LOCALE; ++loc)
-                {
-                    if (loc == GetSessionDbcLocale())
-                        continue;
-
-                    name = spellInfo->SpellName[loc];
-                    if (name.empty())
-                        continue;
-
-                    if (Utf8FitTo(name, wnamepart))
-                        break;
-                }
-            }
+        // spells without name in the session locale are not listed
+        if (!spellInfo || !*spellInfo->SpellName[GetSessionDbcLocale()])
+            continue;
 
-            if (loc < MAX_LOCALE)
-            {
-                ShowSpellListHelper(target, spellInfo, LocaleConstant(loc));
-                ++counter;
-            }
-        }
+        ShowSpellListHelper(target, spellInfo, LocaleConstant(itr->second));
+        ++counter;
     }
     if (counter == 0)                                       // if counter == 0 then we found nth
         SendSysMessage(LANG_COMMAND_NOSPELLFOUND);
@@ -3477,18 +3455,11 @@ bool ChatHandler::HandleLookupQuestCommand(char* args)
 
     int loc_idx = GetSessionDbLocaleIndex();
 
-    ObjectMgr::QuestMap const& qTemplates = sObjectMgr.GetQuestTemplates();
-    for (ObjectMgr::QuestMap::const_iterator iter = qTemplates.begin(); iter != qTemplates.end(); ++iter)
+    NameLookupMatches matches;
+    sNameLookupMgr.Find(NAME_LOOKUP_QUEST, loc_idx, wnamepart, matches);
+    for (NameLookupMatches::const_iterator itr = matches.begin(); itr != matches.end(); ++itr)
     {
-        Quest* qinfo = iter->second;
-
-        std::string title;                                  // "" for avoid repeating check default locale
-        sObjectMgr.GetQuestLocaleStrings(qinfo->GetQuestId(), loc_idx, &title);
-
-        if ((title.empty() || !Utf8FitTo(title, wnamepart)) && !Utf8FitTo(qinfo->GetTitle(), wnamepart))
-            continue;
-
-        ShowQuestListHelper(qinfo->GetQuestId(), loc_idx, target);
+        ShowQuestListHelper(itr->first, loc_idx, target);
         ++counter;
     }
 
@@ -3514,22 +3485,18 @@ bool ChatHandler::HandleLookupCreatureCommand(char* args)
 
     uint32 counter = 0;
 
-    for (uint32 id = 0; id < sCreatureStorage.GetMaxEntry(); ++id)
+    NameLookupMatches matches;
+    sNameLookupMgr.Find(NAME_LOOKUP_CREATURE, GetSessionDbLocaleIndex(), wnamepart, matches);
+    for (NameLookupMatches::const_iterator itr = matches.begin(); itr != matches.end(); ++itr)
     {
+        uint32 id = itr->first;
         CreatureInfo const* cInfo = sCreatureStorage.LookupEntry<CreatureInfo> (id);
         if (!cInfo)
             continue;
 
-        int loc_idx = GetSessionDbLocaleIndex();
-
-        char const* name = "";                              // "" for avoid repeating check for default locale
-        sObjectMgr.GetCreatureLocaleStrings(id, loc_idx, &name);
-        if (!*name || !Utf8FitTo(name, wnamepart))
-        {
-            name = cInfo->Name;
-            if (!Utf8FitTo(name, wnamepart))
-                continue;
-        }
+        char const* name = cInfo->Name;
+        if (itr->second >= 0)                               // matched by the locale name
+            sObjectMgr.GetCreatureLocaleStrings(id, itr->second, &name);
 
         if (m_session)
             PSendSysMessage(LANG_CREATURE_ENTRY_LIST_CHAT, id, id, name);
@@ -3561,43 +3528,23 @@ bool ChatHandler::HandleLookupObjectCommand(char* args)
 
     uint32 counter = 0;
 
-    for (SQLStorageBase::SQLSIterator<GameObjectInfo> itr = sGOStorage.getDataBegin<GameObjectInfo>(); itr < sGOStorage.getDataEnd<GameObjectInfo>(); ++itr)
+    NameLookupMatches matches;
+    sNameLookupMgr.Find(NAME_LOOKUP_GAMEOBJECT, GetSessionDbLocaleIndex(), wnamepart, matches);
+    for (NameLookupMatches::const_iterator itr = matches.begin(); itr != matches.end(); ++itr)
     {
-        int loc_idx = GetSessionDbLocaleIndex();
-        if (loc_idx >= 0)
-        {
-            GameObjectLocale const* gl = sObjectMgr.GetGameObjectLocale(itr->id);
-            if (gl)
-            {
-                if ((int32)gl->Name.size() > loc_idx && !gl->Name[loc_idx].empty())
-                {
-                    std::string name = gl->Name[loc_idx];
-
-                    if (Utf8FitTo(name, wnamepart))
-                    {
-                        if (m_session)
-                            PSendSysMessage(LANG_GO_ENTRY_LIST_CHAT, itr->id, itr->id, name.c_str());
-                        else
-                            PSendSysMessage(LANG_GO_ENTRY_LIST_CONSOLE, itr->id, name.c_str());
-                        ++counter;
-                        continue;
-                    }
-                }
-            }
-        }
-
-        std::string name = itr->name;
-        if (name.empty())
+        GameObjectInfo const* goInfo = ObjectMgr::GetGameObjectInfo(itr->first);
+        if (!goInfo)
             continue;
 
-        if (Utf8FitTo(name, wnamepart))
-        {
-            if (m_session)
-                PSendSysMessage(LANG_GO_ENTRY_LIST_CHAT, itr->id, itr->id, name.c_str());
-            else
-                PSendSysMessage(LANG_GO_ENTRY_LIST_CONSOLE, itr->id, name.c_str());
-            ++counter;
-        }
+        std::string name = goInfo->name;
+        if (itr->second >= 0)                               // matched by the locale name
+            name = sObjectMgr.GetGameObjectLocale(itr->first)->Name[itr->second];
+
+        if (m_session)
+            PSendSysMessage(LANG_GO_ENTRY_LIST_CHAT, itr->first, itr->first, name.c_str());
+        else
+            PSendSysMessage(LANG_GO_ENTRY_LIST_CONSOLE, itr->first, name.c_str());
+        ++counter;
     }
 
     if (counter == 0)
@@ -4435,6 +4382,7 @@ void ChatHandler::HandleCharacterLevel(Player* player, ObjectGuid player_guid, u
     {
         // update level and XP at level, all other will be updated at loading
         CharacterDatabase.PExecute("UPDATE characters SET level = '%u', xp = 0 WHERE guid = '%u'", newlevel, player_guid.GetCounter());
+        sWorld.InvalidateCharEnumOf(player_guid);
     }
 }
 
@@ -6049,6 +5997,7 @@ bool ChatHandler::HandlePDumpLoadCommand(char* args)
     switch (PlayerDumpReader().LoadDump(file, account_id, name, lowguid))
     {
         case DUMP_SUCCESS:
+            sWorld.InvalidateCharEnum(account_id);
             PSendSysMessage(LANG_COMMAND_IMPORT_SUCCESS);
             break;
         case DUMP_FILE_OPEN_ERROR:
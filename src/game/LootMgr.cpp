@@ -65,9 +65,20 @@ class LootTemplate::LootGroup                               // A set of loot def
         void Verify(LootStore const& lootstore, uint32 id, uint32 group_id) const;
         void CollectLootIds(LootIdSet& set) const;
         void CheckLootRefs(LootIdSet* ref_set) const;
+        void BuildRollTable();                              // Precomputes the alias table used by Roll() (at loading stage)
     private:
+        // One column of the alias table: the column outcome is taken with 'chance', else its alias
+        // Outcomes index ExplicitlyChanced, then EqualChanced, -1 is the empty drop
+        struct RollColumn
+        {
+            float chance;
+            int32 outcome;
+            int32 alias;
+        };
+
         LootStoreItemList ExplicitlyChanced;                // Entries with chances defined in DB
         LootStoreItemList EqualChanced;                     // Zero chances - every entry takes the same chance
+        std::vector<RollColumn> RollTable;                  // Same distribution as the chance walk, sampled with one random number
 
         LootStoreItem const* Roll() const;                  // Rolls an item from the group, returns NULL if all miss their chances
 };
@@ -170,6 +181,9 @@ void LootStore::LoadLootTable()
 
         Verify();                                           // Checks validity of the loot store
 
+        for (LootTemplateMap::const_iterator itr = m_LootTemplates.begin(); itr != m_LootTemplates.end(); ++itr)
+            itr->second->BuildRollTables();
+
         sLog.outString(">> Loaded %u loot definitions (" SIZEFMTD " templates) from table %s", count, m_LootTemplates.size(), GetName());
         sLog.outString();
     }
@@ -213,6 +227,7 @@ LootTemplate const* LootStore::GetLootFor(uint32 loot_id) const
 void LootStore::LoadAndCollectLootIds(LootIdSet& ids_set)
 {
     LoadLootTable();
+    ResolveReferences();
 
     for (LootTemplateMap::const_iterator tab = m_LootTemplates.begin(); tab != m_LootTemplates.end(); ++tab)
         ids_set.insert(tab->first);
@@ -224,6 +239,12 @@ void LootStore::CheckLootRefs(LootIdSet* ref_set) const
         ltItr->second->CheckLootRefs(ref_set);
 }
 
+void LootStore::ResolveReferences()
+{
+    for (LootTemplateMap::const_iterator ltItr = m_LootTemplates.begin(); ltItr != m_LootTemplates.end(); ++ltItr)
+        ltItr->second->ResolveReferences();
+}
+
 void LootStore::ReportUnusedIds(LootIdSet const& ids_set) const
 {
     // all still listed ids isn't referenced
@@ -852,27 +873,105 @@ void LootTemplate::LootGroup::AddEntry(LootStoreItem& item)
         EqualChanced.push_back(item);
 }
 
-// Rolls an item from the group, returns NULL if all miss their chances
-LootStoreItem const* LootTemplate::LootGroup::Roll() const
+// Builds the alias table (Vose) for the distribution of the chance walk:
+// explicitly chanced entries in order take their chance of what is left of 100%,
+// the rest is split between the equal chanced entries or is the empty drop
+void LootTemplate::LootGroup::BuildRollTable()
 {
-    if (!ExplicitlyChanced.empty())                         // First explicitly chanced entries are checked
+    std::vector<int32> outcomes;
+    std::vector<float> weights;
+
+    float remaining = 100.0f;
+    for (uint32 i = 0; i < ExplicitlyChanced.size() && remaining > 0.0f; ++i)
     {
-        float Roll = rand_chance_f();
+        float weight = ExplicitlyChanced[i].chance >= 100.0f ? remaining : std::min(ExplicitlyChanced[i].chance, remaining);
+        outcomes.push_back(int32(i));
+        weights.push_back(weight);
+        remaining -= weight;
+    }
 
-        for (uint32 i = 0; i < ExplicitlyChanced.size(); ++i) // check each explicitly chanced entry in the template and modify its chance based on quality.
+    if (remaining > 0.0f)
+    {
+        if (EqualChanced.empty())
         {
-            if (ExplicitlyChanced[i].chance >= 100.0f)
-                return &ExplicitlyChanced[i];
+            outcomes.push_back(-1);
+            weights.push_back(remaining);
+        }
+        else
+        {
+            for (uint32 i = 0; i < EqualChanced.size(); ++i)
+            {
+                outcomes.push_back(int32(ExplicitlyChanced.size() + i));
+                weights.push_back(remaining / EqualChanced.size());
+            }
+        }
+    }
+
+    RollTable.clear();
+    if (outcomes.empty())
+        return;
+
+    uint32 size = outcomes.size();
+    RollTable.resize(size);
+
+    // scale to an average of 1 per column, then pair each small column with a large one
+    std::vector<float> scaled(size);
+    std::vector<uint32> small, large;
+    for (uint32 i = 0; i < size; ++i)
+    {
+        scaled[i] = weights[i] * size / 100.0f;
+        (scaled[i] < 1.0f ? small : large).push_back(i);
+    }
 
-            Roll -= ExplicitlyChanced[i].chance;
-            if (Roll < 0)
-                return &ExplicitlyChanced[i];
+    while (!small.empty() && !large.empty())
+    {
+        uint32 s = small.back();
+        small.pop_back();
+        uint32 l = large.back();
+
+        RollTable[s].chance = scaled[s];
+        RollTable[s].outcome = outcomes[s];
+        RollTable[s].alias = outcomes[l];
+
+        scaled[l] -= 1.0f - scaled[s];
+        if (scaled[l] < 1.0f)
+        {
+            large.pop_back();
+            small.push_back(l);
         }
     }
-    if (!EqualChanced.empty())                              // If nothing selected yet - an item is taken from equal-chanced part
-        return &EqualChanced[irand(0, EqualChanced.size() - 1)];
 
-    return NULL;                                            // Empty drop from the group
+    // left overs are full columns (up to rounding)
+    for (std::vector<uint32>::const_iterator itr = large.begin(); itr != large.end(); ++itr)
+    {
+        RollTable[*itr].chance = 1.0f;
+        RollTable[*itr].outcome = RollTable[*itr].alias = outcomes[*itr];
+    }
+    for (std::vector<uint32>::const_iterator itr = small.begin(); itr != small.end(); ++itr)
+    {
+        RollTable[*itr].chance = 1.0f;
+        RollTable[*itr].outcome = RollTable[*itr].alias = outcomes[*itr];
+    }
+}
+
+// Rolls an item from the group, returns NULL if all miss their chances
+LootStoreItem const* LootTemplate::LootGroup::Roll() const
+{
+    if (RollTable.empty())
+        return NULL;
+
+    double roll = rand_norm() * RollTable.size();
+    uint32 column = std::min(uint32(roll), uint32(RollTable.size() - 1));
+    RollColumn const& entry = RollTable[column];
+    int32 outcome = roll - column < entry.chance ? entry.outcome : entry.alias;
+
+    if (outcome < 0)
+        return NULL;                                        // Empty drop from the group
+
+    if (uint32(outcome) < ExplicitlyChanced.size())
+        return &ExplicitlyChanced[outcome];
+
+    return &EqualChanced[outcome - ExplicitlyChanced.size()];
 }
 
 // True if group includes at least 1 quest drop entry
@@ -1006,7 +1105,7 @@ void LootTemplate::Process(Loot& loot, LootStore const& store, bool rate, uint8
 
         if (i->mincountOrRef < 0)                           // References processing
         {
-            LootTemplate const* Referenced = LootTemplates_Reference.GetLootFor(-i->mincountOrRef);
+            LootTemplate const* Referenced = i->reference ? i->reference : LootTemplates_Reference.GetLootFor(-i->mincountOrRef);
 
             if (!Referenced)
                 continue;                                   // Error message already printed at loading stage
@@ -1102,6 +1201,19 @@ void LootTemplate::Verify(LootStore const& lootstore, uint32 id) const
     // TODO: References validity checks
 }
 
+void LootTemplate::BuildRollTables()
+{
+    for (LootGroups::iterator i = Groups.begin(); i != Groups.end(); ++i)
+        i->BuildRollTable();
+}
+
+void LootTemplate::ResolveReferences()
+{
+    for (LootStoreItemList::iterator i = Entries.begin(); i != Entries.end(); ++i)
+        if (i->mincountOrRef < 0)
+            i->reference = LootTemplates_Reference.GetLootFor(-i->mincountOrRef);
+}
+
 void LootTemplate::CheckLootRefs(LootIdSet* ref_set) const
 {
     for (LootStoreItemList::const_iterator ieItr = Entries.begin(); ieItr != Entries.end(); ++ieItr)
@@ -1397,6 +1509,19 @@ void LoadLootTemplates_Reference()
     LootIdSet ids_set;
     LootTemplates_Reference.LoadAndCollectLootIds(ids_set);
 
+    // rebind the references of all stores to the new templates
+    LootTemplates_Creature.ResolveReferences();
+    LootTemplates_Fishing.ResolveReferences();
+    LootTemplates_Gameobject.ResolveReferences();
+    LootTemplates_Item.ResolveReferences();
+    LootTemplates_Milling.ResolveReferences();
+    LootTemplates_Pickpocketing.ResolveReferences();
+    LootTemplates_Skinning.ResolveReferences();
+    LootTemplates_Disenchant.ResolveReferences();
+    LootTemplates_Prospecting.ResolveReferences();
+    LootTemplates_Mail.ResolveReferences();
+    LootTemplates_Spell.ResolveReferences();
+
     // check references and remove used
     LootTemplates_Creature.CheckLootRefs(&ids_set);
     LootTemplates_Fishing.CheckLootRefs(&ids_set);
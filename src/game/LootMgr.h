@@ -71,6 +71,8 @@ enum LootSlotType
     MAX_LOOT_SLOT_TYPE                                      // custom, use for mark skipped from show items
 };
 
+class LootTemplate;
+
 struct LootStoreItem
 {
     uint32  itemid;                                         // id of the item
@@ -80,12 +82,13 @@ struct LootStoreItem
     bool    needs_quest : 1;                                // quest drop (negative ChanceOrQuestChance in DB)
     uint8   maxcount    : 8;                                // max drop count for the item (mincountOrRef positive) or Ref multiplicator (mincountOrRef negative)
     uint16  conditionId : 16;                               // additional loot condition Id
+    LootTemplate const* reference;                          // resolved reference template (mincountOrRef negative), NULL if not resolved
 
     // Constructor, converting ChanceOrQuestChance -> (chance, needs_quest)
     // displayid is filled in IsValid() which must be called after
     LootStoreItem(uint32 _itemid, float _chanceOrQuestChance, int8 _group, uint16 _conditionId, int32 _mincountOrRef, uint8 _maxcount)
         : itemid(_itemid), chance(fabs(_chanceOrQuestChance)), mincountOrRef(_mincountOrRef),
-          group(_group), needs_quest(_chanceOrQuestChance < 0), maxcount(_maxcount), conditionId(_conditionId)
+          group(_group), needs_quest(_chanceOrQuestChance < 0), maxcount(_maxcount), conditionId(_conditionId), reference(NULL)
     {}
 
     bool Roll(bool rate) const;                             // Checks if the entry takes it's chance (at loot generation)
@@ -133,7 +136,6 @@ struct QuestItem
 };
 
 struct Loot;
-class LootTemplate;
 
 typedef std::vector<QuestItem> QuestItemList;
 typedef std::map<uint32, QuestItemList*> QuestItemMap;
@@ -155,6 +157,7 @@ class LootStore
         void CheckLootRefs(LootIdSet* ref_set = NULL) const;// check existence reference and remove it from ref_set
         void ReportUnusedIds(LootIdSet const& ids_set) const;
         void ReportNotExistedId(uint32 id) const;
+        void ResolveReferences();                           // bind reference entries to the current reference templates
 
         bool HaveLootFor(uint32 loot_id) const { return m_LootTemplates.find(loot_id) != m_LootTemplates.end(); }
         bool HaveQuestLootFor(uint32 loot_id) const;
@@ -194,6 +197,10 @@ class LootTemplate
         // Checks integrity of the template
         void Verify(LootStore const& store, uint32 Id) const;
         void CheckLootRefs(LootIdSet* ref_set) const;
+
+        // Precomputes the group roll tables (at loading stage, after all entries are added)
+        void BuildRollTables();
+        void ResolveReferences();
     private:
         LootStoreItemList Entries;                          // not grouped only
         LootGroups        Groups;                           // groups have own (optimised) processing, grouped entries go there
@@ -36,9 +36,14 @@
 #include "MapPersistentStateMgr.h"
 #include "VMapFactory.h"
 #include "MoveMap.h"
+#include "movement/MoveSpline.h"
 #include "BattleGround/BattleGroundMgr.h"
 #include "Calendar.h"
 #include "Chat.h"
+#include "Database/DatabaseEnv.h"
+
+// creatures handled per CreatureUpdateTier, maps are only updated from the world thread
+static uint32 s_creatureUpdateCount[MAX_CREATURE_UPDATE_TIER] = { 0, 0, 0 };
 
 Map::~Map()
 {
@@ -53,6 +58,10 @@ Map::~Map()
     delete i_data;
     i_data = NULL;
 
+    // queries still in flight call back on the world thread
+    m_resultQueue->Detach(CharacterDatabase.GetResultQueue());
+    m_resultQueue = NULL;
+
     // unload instance specific navigation data
     MMAP::MMapFactory::createOrGetMMapManager()->unloadMapInstance(m_TerrainData->GetMapId(), GetInstanceId());
 
@@ -72,11 +81,11 @@ void Map::LoadMapAndVMap(int gx, int gy)
 
 Map::Map(uint32 id, time_t expiry, uint32 InstanceId, uint8 SpawnMode)
     : i_mapEntry(sMapStore.LookupEntry(id)), i_spawnMode(SpawnMode),
-      i_id(id), i_InstanceId(InstanceId), m_unloadTimer(0),
+      i_id(id), i_InstanceId(InstanceId), m_updateId(0), m_unloadTimer(0),
       m_VisibleDistance(DEFAULT_VISIBILITY_DISTANCE), m_persistentState(NULL),
       m_activeNonPlayersIter(m_activeNonPlayers.end()),
       i_gridExpiry(expiry), m_TerrainData(sTerrainMgr.LoadTerrain(id)),
-      i_data(NULL), i_script_id(0)
+      i_data(NULL), i_script_id(0), m_resultQueue(new SqlResultQueue)
 {
     m_CreatureGuids.Set(sObjectMgr.GetFirstTemporaryCreatureLowGuid());
     m_GameObjectGuids.Set(sObjectMgr.GetFirstTemporaryGameObjectLowGuid());
@@ -439,8 +448,13 @@ bool Map::loaded(const GridPair& p) const
 
 void Map::Update(const uint32& t_diff)
 {
+    ++m_updateId;
     m_dyn_tree.update(t_diff);
 
+    /// run callbacks of the async queries issued by earlier updates, new ones come back here too
+    m_resultQueue->Update();
+    SqlResultQueueScope resultQueueScope(CharacterDatabase, m_resultQueue);
+
     /// update worldsessions for existing players
     for (m_mapRefIter = m_mapRefManager.begin(); m_mapRefIter != m_mapRefManager.end(); ++m_mapRefIter)
     {
@@ -468,7 +482,62 @@ void Map::Update(const uint32& t_diff)
     /// update active cells around players and active objects
     resetMarkedCells();
 
-    MaNGOS::ObjectUpdater updater(t_diff);
+    // idle creatures close to players are still updated every tick, so update those cells first
+    uint32 idleInterval = sWorld.getConfig(CONFIG_UINT32_IDLE_UPDATE_INTERVAL);
+    float idleDistance = sWorld.getConfig(CONFIG_FLOAT_IDLE_UPDATE_DISTANCE);
+    if (idleDistance <= 0.0f || idleDistance >= GetVisibilityDistance())
+        idleInterval = 0;
+
+    MaNGOS::ObjectUpdater updater(t_diff, m_updateId);
+    if (idleInterval)
+        UpdateActiveCells(idleDistance, updater);
+
+    MaNGOS::ObjectUpdater idleUpdater(t_diff, m_updateId, idleInterval);
+    UpdateActiveCells(GetVisibilityDistance(), idleUpdater);
+
+    for (int i = 0; i < MAX_CREATURE_UPDATE_TIER; ++i)
+        s_creatureUpdateCount[i] += updater.i_creatureCount[i] + idleUpdater.i_creatureCount[i];
+
+    // Move units along their splines, all positions of this tick in one pass
+    UpdateSplineRelocations();
+
+    // Send world objects and item update field changes
+    SendObjectUpdates();
+
+    // Don't unload grids if it's battleground, since we may have manually added GOs,creatures, those doesn't load from DB at grid re-load !
+    // This isn't really bother us, since as soon as we have instanced BG-s, the whole map unloads as the BG gets ended
+    if (!IsBattleGroundOrArena())
+    {
+        for (GridRefManager<NGridType>::iterator i = GridRefManager<NGridType>::begin(); i != GridRefManager<NGridType>::end();)
+        {
+            NGridType* grid = i->getSource();
+            GridInfo* info = i->getSource()->getGridInfoRef();
+            ++i;                                            // The update might delete the map and we need the next map before the iterator gets invalid
+            MANGOS_ASSERT(grid->GetGridState() >= 0 && grid->GetGridState() < MAX_GRID_STATE);
+            sMapMgr.UpdateGridState(grid->GetGridState(), *this, *grid, *info, grid->getX(), grid->getY(), t_diff);
+        }
+    }
+
+    ///- Process necessary scripts
+    if (!m_scriptSchedule.empty())
+        ScriptsProcess();
+
+    if (i_data)
+        i_data->Update(t_diff);
+}
+
+void Map::GetCreatureUpdateStats(uint32& full, uint32& idle, uint32& deferred)
+{
+    full = s_creatureUpdateCount[CREATURE_UPDATE_TIER_FULL];
+    idle = s_creatureUpdateCount[CREATURE_UPDATE_TIER_IDLE];
+    deferred = s_creatureUpdateCount[CREATURE_UPDATE_TIER_DEFERRED];
+
+    for (int i = 0; i < MAX_CREATURE_UPDATE_TIER; ++i)
+        s_creatureUpdateCount[i] = 0;
+}
+
+void Map::UpdateActiveCells(float radius, MaNGOS::ObjectUpdater& updater)
+{
     // for creature
     TypeContainerVisitor<MaNGOS::ObjectUpdater, GridTypeMapContainer  > grid_object_update(updater);
     // for pets
@@ -484,7 +553,7 @@ void Map::Update(const uint32& t_diff)
             continue;
 
         // lets update mobs/objects in ALL visible cells around player!
-        CellArea area = Cell::CalculateCellArea(plr->GetPositionX(), plr->GetPositionY(), GetVisibilityDistance());
+        CellArea area = Cell::CalculateCellArea(plr->GetPositionX(), plr->GetPositionY(), radius);
 
         for (uint32 x = area.low_bound.x_coord; x <= area.high_bound.x_coord; ++x)
         {
@@ -522,7 +591,7 @@ void Map::Update(const uint32& t_diff)
                 continue;
 
             // lets update mobs/objects in ALL visible cells around player!
-            CellArea area = Cell::CalculateCellArea(obj->GetPositionX(), obj->GetPositionY(), GetVisibilityDistance());
+            CellArea area = Cell::CalculateCellArea(obj->GetPositionX(), obj->GetPositionY(), radius);
 
             for (uint32 x = area.low_bound.x_coord; x <= area.high_bound.x_coord; ++x)
             {
@@ -544,30 +613,6 @@ void Map::Update(const uint32& t_diff)
             }
         }
     }
-
-    // Send world objects and item update field changes
-    SendObjectUpdates();
-
-    // Don't unload grids if it's battleground, since we may have manually added GOs,creatures, those doesn't load from DB at grid re-load !
-    // This isn't really bother us, since as soon as we have instanced BG-s, the whole map unloads as the BG gets ended
-    if (!IsBattleGroundOrArena())
-    {
-        for (GridRefManager<NGridType>::iterator i = GridRefManager<NGridType>::begin(); i != GridRefManager<NGridType>::end();)
-        {
-            NGridType* grid = i->getSource();
-            GridInfo* info = i->getSource()->getGridInfoRef();
-            ++i;                                            // The update might delete the map and we need the next map before the iterator gets invalid
-            MANGOS_ASSERT(grid->GetGridState() >= 0 && grid->GetGridState() < MAX_GRID_STATE);
-            sMapMgr.UpdateGridState(grid->GetGridState(), *this, *grid, *info, grid->getX(), grid->getY(), t_diff);
-        }
-    }
-
-    ///- Process necessary scripts
-    if (!m_scriptSchedule.empty())
-        ScriptsProcess();
-
-    if (i_data)
-        i_data->Update(t_diff);
 }
 
 void Map::Remove(Player* player, bool remove)
@@ -1820,6 +1865,37 @@ WorldObject* Map::GetWorldObject(ObjectGuid guid)
     return NULL;
 }
 
+void Map::ScheduleSplineRelocation(Unit* unit)
+{
+    m_splineRelocations.push_back(unit->GetObjectGuid());
+}
+
+void Map::UpdateSplineRelocations()
+{
+    if (m_splineRelocations.empty())
+        return;
+
+    std::vector<Unit*> units;
+    units.reserve(m_splineRelocations.size());
+
+    // units may have left the map or arrived since they were queued
+    for (GuidVector::const_iterator itr = m_splineRelocations.begin(); itr != m_splineRelocations.end(); ++itr)
+    {
+        Unit* unit = GetUnit(*itr);
+        if (unit && unit->IsInWorld() && !unit->movespline->Finalized())
+            units.push_back(unit);
+    }
+    m_splineRelocations.clear();
+
+    // evaluate all positions first, relocation visits grids and may call into AI
+    std::vector<Movement::Location> locations(units.size());
+    for (size_t i = 0; i < units.size(); ++i)
+        locations[i] = units[i]->movespline->ComputePosition();
+
+    for (size_t i = 0; i < units.size(); ++i)
+        units[i]->RelocateBySpline(locations[i]);
+}
+
 void Map::SendObjectUpdates()
 {
     UpdateDataMapType update_players;
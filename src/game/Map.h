@@ -56,6 +56,12 @@ struct ScriptInfo;
 class BattleGround;
 class GridMap;
 class GameObjectModel;
+class SqlResultQueue;
+
+namespace MaNGOS
+{
+    struct ObjectUpdater;
+}
 
 // GCC have alternative #pragma pack(N) syntax and old gcc version not support pack(push,N), also any gcc version not support it at some platform
 #if defined( __GNUC__ )
@@ -123,6 +129,9 @@ class MANGOS_DLL_SPEC Map : public GridRefManager<NGridType>
 
         virtual void Update(const uint32&);
 
+        // creatures handled per CreatureUpdateTier by all map updates since the previous call
+        static void GetCreatureUpdateStats(uint32& full, uint32& idle, uint32& deferred);
+
         void MessageBroadcast(Player const*, WorldPacket*, bool to_self);
         void MessageBroadcast(WorldObject const*, WorldPacket*);
         void MessageDistBroadcast(Player const*, WorldPacket*, float dist, bool to_self, bool own_team_only = false);
@@ -256,6 +265,9 @@ class MANGOS_DLL_SPEC Map : public GridRefManager<NGridType>
             i_objectsToClientUpdate.erase(obj);
         }
 
+        // queue a unit's in-flight spline position, evaluated with the rest of the map after the object updates
+        void ScheduleSplineRelocation(Unit* unit);
+
         // DynObjects currently
         uint32 GenerateLocalLowGuid(HighGuid guidhigh);
 
@@ -329,6 +341,7 @@ class MANGOS_DLL_SPEC Map : public GridRefManager<NGridType>
         uint8 i_spawnMode;
         uint32 i_id;
         uint32 i_InstanceId;
+        uint32 m_updateId;                                  // incremented each map update, tells creatures whether they missed one
         uint32 m_unloadTimer;
         float m_VisibleDistance;
         MapPersistentState* m_persistentState;
@@ -342,6 +355,9 @@ class MANGOS_DLL_SPEC Map : public GridRefManager<NGridType>
         MapStoredObjectTypesContainer m_objectsStore;
 
     private:
+        void UpdateActiveCells(float radius, MaNGOS::ObjectUpdater& updater);
+        void UpdateSplineRelocations();
+
         time_t i_gridExpiry;
 
         NGridType* i_grids[MAX_NUMBER_OF_GRIDS][MAX_NUMBER_OF_GRIDS];
@@ -353,6 +369,7 @@ class MANGOS_DLL_SPEC Map : public GridRefManager<NGridType>
         std::bitset<TOTAL_NUMBER_OF_CELLS_PER_MAP* TOTAL_NUMBER_OF_CELLS_PER_MAP> marked_cells;
 
         std::set<WorldObject*> i_objectsToRemove;
+        GuidVector m_splineRelocations;
 
         typedef std::multimap<time_t, ScriptAction> ScriptScheduleMap;
         ScriptScheduleMap m_scriptSchedule;
@@ -360,6 +377,9 @@ class MANGOS_DLL_SPEC Map : public GridRefManager<NGridType>
         InstanceData* i_data;
         uint32 i_script_id;
 
+        // Callbacks of async queries issued while updating this map
+        SqlResultQueue* m_resultQueue;
+
         // Map local low guid counters
         ObjectGuidGenerator<HIGHGUID_UNIT> m_CreatureGuids;
         ObjectGuidGenerator<HIGHGUID_GAMEOBJECT> m_GameObjectGuids;
@@ -100,10 +100,8 @@ Map* MapManager::CreateMap(uint32 id, const WorldObject* obj)
     if (entry->Instanceable())
     {
         MANGOS_ASSERT(obj && obj->GetTypeId() == TYPEID_PLAYER);
-        // create DungeonMap object
+        // create DungeonMap object, active objects are loaded at its creation
         m = CreateInstance(id, (Player*)obj);
-        // Load active objects for this map
-        sObjectMgr.LoadActiveEntities(m);
     }
     else
     {
@@ -263,6 +261,12 @@ uint32 MapManager::GetNumPlayersInInstances()
     return ret;
 }
 
+UpdateTimeStats MapManager::GetInstanceCreationStats()
+{
+    Guard _guard(*this);
+    return i_instanceCreateStats.Collect();
+}
+
 ///// returns a new or existing Instance
 ///// in case of battlegrounds it will only return an existing map, those maps are created by bg-system
 Map* MapManager::CreateInstance(uint32 id, Player* player)
@@ -271,6 +275,7 @@ Map* MapManager::CreateInstance(uint32 id, Player* player)
     Map* pNewMap = NULL;
     uint32 NewInstanceId = 0;                               // instanceId of the resulting map
     const MapEntry* entry = sMapStore.LookupEntry(id);
+    uint32 createStart = WorldTimer::getMSTime();
 
     if (entry->IsBattleGroundOrArena())
     {
@@ -304,6 +309,14 @@ Map* MapManager::CreateInstance(uint32 id, Player* player)
     {
         i_maps[MapID(id, NewInstanceId)] = pNewMap;
         map = pNewMap;
+
+        // Load active objects for this map
+        sObjectMgr.LoadActiveEntities(pNewMap);
+
+        uint32 createTime = WorldTimer::getMSTimeDiff(createStart, WorldTimer::getMSTime());
+        i_instanceCreateStats.Add(createTime);
+
+        DEBUG_LOG("MapManager::CreateInstance: map instance %u for %u created in %u ms", NewInstanceId, id, createTime);
     }
 
     return map;
@@ -357,5 +370,8 @@ BattleGroundMap* MapManager::CreateBattleGroundMap(uint32 id, uint32 InstanceId,
     // BGs/Arenas not have saved instance data
     map->CreateInstanceData(false);
 
+    // Load active objects for this map
+    sObjectMgr.LoadActiveEntities(map);
+
     return map;
 }
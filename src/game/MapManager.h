@@ -143,6 +143,8 @@ class MANGOS_DLL_DECL MapManager : public MaNGOS::Singleton<MapManager, MaNGOS::
         /* statistics */
         uint32 GetNumInstances();
         uint32 GetNumPlayersInInstances();
+        // dungeon maps created since the last call, their total and longest creation time in ms
+        UpdateTimeStats GetInstanceCreationStats();
 
         // get list of all maps
         const MapMapType& Maps() const { return i_maps; }
@@ -174,6 +176,8 @@ class MANGOS_DLL_DECL MapManager : public MaNGOS::Singleton<MapManager, MaNGOS::
         uint32 i_gridCleanUpDelay;
         MapMapType i_maps;
         IntervalTimer i_timer;
+
+        UpdateTimeStats i_instanceCreateStats;
 };
 
 template<typename Do>
@@ -31,6 +31,11 @@
 #include "WaypointMovementGenerator.h"
 #include "MapPersistentStateMgr.h"
 #include "ObjectMgr.h"
+#include "World.h"
+#include "GridNotifiers.h"
+#include "CellImpl.h"
+
+#include <ace/Atomic_Op.h>
 
 void WorldSession::HandleMoveWorldportAckOpcode(WorldPacket& /*recv_data*/)
 {
@@ -272,12 +277,25 @@ void WorldSession::HandleMovementOpcodes(WorldPacket& recv_data)
     ObjectGuid guid;
     MovementInfo movementInfo;
 
-    recv_data >> guid.ReadAsPacked();
-    recv_data >> movementInfo;
-    /*----------------*/
+    // received packets are already decoded and position checked by the network thread
+    MovementPacket const* decoded = dynamic_cast<MovementPacket const*>(&recv_data);
+    if (decoded && decoded->IsDecoded())
+    {
+        guid = decoded->GetMoverGuid();
+        movementInfo = decoded->GetMovementInfo();
 
-    if (!VerifyMovementInfo(movementInfo, guid))
-        return;
+        if (guid != mover->GetObjectGuid())
+            return;
+    }
+    else
+    {
+        recv_data >> guid.ReadAsPacked();
+        recv_data >> movementInfo;
+
+        if (!VerifyMovementInfo(movementInfo, guid))
+            return;
+    }
+    /*----------------*/
 
     // fall damage generation (ignore in flight case that can be triggered also at lags in moment teleportation to another map).
     if (opcode == MSG_MOVE_FALL_LAND && plMover && !plMover->IsTaxiFlying())
@@ -292,7 +310,102 @@ void WorldSession::HandleMovementOpcodes(WorldPacket& recv_data)
     WorldPacket data(opcode, recv_data.size());
     data << mover->GetPackGUID();             // write guid
     movementInfo.Write(data);                               // write data
+    RelayMovement(mover, data);
+}
+
+typedef ACE_Atomic_Op<ACE_Thread_Mutex, long> MovementRelayCounter;
+
+static MovementRelayCounter s_movementRelayed;
+static MovementRelayCounter s_movementCoalesced;
+static MovementRelayCounter s_movementFarSkipped;
+
+/// Current value of the counter, it is reset without losing increments of other threads made meanwhile
+static uint32 CollectMovementRelayCounter(MovementRelayCounter& counter)
+{
+    long value = counter.value();
+    counter -= value;
+    return uint32(value);
+}
+
+/// Opcodes only updating the position of the mover, a newer one makes the older obsolete
+static bool IsCoalescableMovement(Opcodes opcode)
+{
+    switch (opcode)
+    {
+        case MSG_MOVE_HEARTBEAT:
+        case MSG_MOVE_SET_FACING:
+        case MSG_MOVE_SET_PITCH:
+            return true;
+        default:
+            return false;
+    }
+}
+
+void WorldSession::RelayMovement(Unit* mover, WorldPacket& data)
+{
+    if (!sWorld.getConfig(CONFIG_BOOL_MOVEMENT_RELAY_COALESCE))
+    {
+        mover->SendMessageToSetExcept(&data, _player);
+        ++s_movementRelayed;
+        return;
+    }
+
+    // any newer movement of the mover carries its full position, pending update is obsolete
+    if (m_movementRelay && m_movementRelay->GetOpcode() != MSG_NULL_ACTION)
+    {
+        ++s_movementCoalesced;
+        m_movementRelay->Initialize(MSG_NULL_ACTION, 0);
+    }
+
+    if (IsCoalescableMovement(data.GetOpcode()))
+    {
+        if (!m_movementRelay)
+            m_movementRelay = new WorldPacket();
+
+        // reuse the pending packet storage instead of copying the packet object
+        m_movementRelay->Initialize(data.GetOpcode(), data.size());
+        m_movementRelay->append(data.contents(), data.wpos());
+        m_movementRelayMover = mover->GetObjectGuid();
+        return;
+    }
+
+    // state changes (start, stop, jump, fall...) are relayed at once to everybody
     mover->SendMessageToSetExcept(&data, _player);
+    ++s_movementRelayed;
+}
+
+void WorldSession::FlushMovementRelay()
+{
+    if (!m_movementRelay || m_movementRelay->GetOpcode() == MSG_NULL_ACTION)
+        return;
+
+    Unit* mover = _player ? _player->GetMover() : NULL;
+
+    // mover changed or left the world since the update was received
+    if (mover && mover->IsInWorld() && mover->GetObjectGuid() == m_movementRelayMover)
+    {
+        float nearDist = sWorld.getConfig(CONFIG_FLOAT_MOVEMENT_RELAY_FAR_DISTANCE);
+        bool toFar = nearDist <= 0.0f || WorldTimer::getMSTimeDiff(m_movementRelayFarTime, WorldTimer::getMSTime()) >= sWorld.getConfig(CONFIG_UINT32_MOVEMENT_RELAY_FAR_INTERVAL);
+
+        if (toFar)
+            m_movementRelayFarTime = WorldTimer::getMSTime();
+
+        MaNGOS::MovementRelayDeliverer notifier(*mover, m_movementRelay, _player, nearDist, toFar);
+        Cell::VisitWorldObjects(mover, notifier, mover->GetMap()->GetVisibilityDistance());
+
+        ++s_movementRelayed;
+        if (notifier.i_farSkipped)
+            s_movementFarSkipped += notifier.i_farSkipped;
+    }
+
+    m_movementRelay->Initialize(MSG_NULL_ACTION, 0);
+}
+
+void WorldSession::GetMovementRelayStats(uint32& relayed, uint32& coalesced, uint32& farSkipped)
+{
+    relayed = CollectMovementRelayCounter(s_movementRelayed);
+    coalesced = CollectMovementRelayCounter(s_movementCoalesced);
+    farSkipped = CollectMovementRelayCounter(s_movementFarSkipped);
 }
 
 void WorldSession::HandleForceSpeedChangeAckOpcodes(WorldPacket& recv_data)
@@ -513,24 +626,7 @@ bool WorldSession::VerifyMovementInfo(MovementInfo const& movementInfo, ObjectGu
     if (guid != _player->GetMover()->GetObjectGuid())
         return false;
 
-    if (!MaNGOS::IsValidMapCoord(movementInfo.GetPos()->x, movementInfo.GetPos()->y, movementInfo.GetPos()->z, movementInfo.GetPos()->o))
-        return false;
-
-    if (movementInfo.HasMovementFlag(MOVEFLAG_ONTRANSPORT))
-    {
-        // transports size limited
-        // (also received at zeppelin/lift leave by some reason with t_* as absolute in continent coordinates, can be safely skipped)
-        if (movementInfo.GetTransportPos()->x > 50 || movementInfo.GetTransportPos()->y > 50 || movementInfo.GetTransportPos()->z > 100)
-            return false;
-
-        if (!MaNGOS::IsValidMapCoord(movementInfo.GetPos()->x + movementInfo.GetTransportPos()->x, movementInfo.GetPos()->y + movementInfo.GetTransportPos()->y,
-                                     movementInfo.GetPos()->z + movementInfo.GetTransportPos()->z, movementInfo.GetPos()->o + movementInfo.GetTransportPos()->o))
-        {
-            return false;
-        }
-    }
-
-    return true;
+    return movementInfo.HasValidCoordinates();
 }
 
 void WorldSession::HandleMoverRelocation(MovementInfo& movementInfo)
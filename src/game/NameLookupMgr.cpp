@@ -0,0 +1,199 @@
+/*
+ * This file is part of the CMaNGOS Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "NameLookupMgr.h"
+#include "Policies/Singleton.h"
+#include "ObjectMgr.h"
+#include "SQLStorages.h"
+#include "DBCStores.h"
+#include "Util.h"
+
+INSTANTIATE_SINGLETON_1(NameLookupMgr);
+
+void NameLookupIndex::Add(uint32 id, std::string const& name)
+{
+    std::wstring wname;
+    if (name.empty() || !Utf8toWStr(name, wname))
+        return;
+
+    wstrToLower(wname);
+
+    uint32 index = m_names.size();
+    m_ids.push_back(id);
+    m_names.push_back(wname);
+
+    for (size_t i = 0; i + 3 <= wname.size(); ++i)
+    {
+        Postings& postings = m_trigrams[MakeTrigram(&wname[i])];
+        if (postings.empty() || postings.back() != index)
+            postings.push_back(index);
+    }
+}
+
+void NameLookupIndex::Find(std::wstring const& search, std::vector<uint32>& ids) const
+{
+    // too short for a trigram, check all names
+    if (search.size() < 3)
+    {
+        for (size_t i = 0; i < m_names.size(); ++i)
+            if (m_names[i].find(search) != std::wstring::npos)
+                ids.push_back(m_ids[i]);
+        return;
+    }
+
+    // every trigram of the search string must be in the name, verify the names of the rarest one
+    Postings const* candidates = NULL;
+    for (size_t i = 0; i + 3 <= search.size(); ++i)
+    {
+        TrigramMap::const_iterator itr = m_trigrams.find(MakeTrigram(&search[i]));
+        if (itr == m_trigrams.end())
+            return;
+
+        if (!candidates || itr->second.size() < candidates->size())
+            candidates = &itr->second;
+    }
+
+    for (Postings::const_iterator itr = candidates->begin(); itr != candidates->end(); ++itr)
+        if (m_names[*itr].find(search) != std::wstring::npos)
+            ids.push_back(m_ids[*itr]);
+}
+
+void NameLookupMgr::Find(NameLookupType type, int locale, std::wstring const& search, NameLookupMatches& matches)
+{
+    std::vector<int> locales;
+    locales.push_back(locale);
+    if (type == NAME_LOOKUP_SPELL)
+    {
+        for (int i = 0; i < MAX_LOCALE; ++i)
+            if (i != locale)
+                locales.push_back(i);
+    }
+    else if (locale >= 0)
+        locales.push_back(-1);
+
+    // first matching locale wins for an id
+    std::map<uint32, int> found;
+    std::vector<uint32> ids;
+    for (std::vector<int>::const_iterator loc = locales.begin(); loc != locales.end(); ++loc)
+    {
+        ids.clear();
+        GetIndex(type, *loc).Find(search, ids);
+        for (std::vector<uint32>::const_iterator itr = ids.begin(); itr != ids.end(); ++itr)
+            found.insert(std::map<uint32, int>::value_type(*itr, *loc));
+    }
+
+    matches.reserve(matches.size() + found.size());
+    for (std::map<uint32, int>::const_iterator itr = found.begin(); itr != found.end(); ++itr)
+        matches.push_back(NameLookupMatch(itr->first, itr->second));
+}
+
+NameLookupIndex const& NameLookupMgr::GetIndex(NameLookupType type, int locale)
+{
+    LocaleIndexMap::iterator itr = m_indexes[type].find(locale);
+    if (itr != m_indexes[type].end())
+        return itr->second;
+
+    NameLookupIndex& index = m_indexes[type][locale];
+    BuildIndex(type, locale, index);
+    DEBUG_LOG("NameLookupMgr: built name index of type %u for locale %i with " SIZEFMTD " names", uint32(type), locale, index.GetCount());
+    return index;
+}
+
+void NameLookupMgr::BuildIndex(NameLookupType type, int locale, NameLookupIndex& index) const
+{
+    switch (type)
+    {
+        case NAME_LOOKUP_ITEM:
+        {
+            for (uint32 id = 0; id < sItemStorage.GetMaxEntry(); ++id)
+            {
+                ItemPrototype const* pProto = sItemStorage.LookupEntry<ItemPrototype>(id);
+                if (!pProto)
+                    continue;
+
+                std::string name;
+                if (locale >= 0)
+                    sObjectMgr.GetItemLocaleStrings(id, locale, &name);
+                else
+                    name = pProto->Name1;
+
+                index.Add(id, name);
+            }
+            break;
+        }
+        case NAME_LOOKUP_CREATURE:
+        {
+            for (uint32 id = 0; id < sCreatureStorage.GetMaxEntry(); ++id)
+            {
+                CreatureInfo const* cInfo = sCreatureStorage.LookupEntry<CreatureInfo>(id);
+                if (!cInfo)
+                    continue;
+
+                char const* name = "";
+                if (locale >= 0)
+                    sObjectMgr.GetCreatureLocaleStrings(id, locale, &name);
+                else
+                    name = cInfo->Name;
+
+                index.Add(id, name);
+            }
+            break;
+        }
+        case NAME_LOOKUP_GAMEOBJECT:
+        {
+            for (SQLStorageBase::SQLSIterator<GameObjectInfo> itr = sGOStorage.getDataBegin<GameObjectInfo>(); itr < sGOStorage.getDataEnd<GameObjectInfo>(); ++itr)
+            {
+                if (locale < 0)
+                {
+                    index.Add(itr->id, itr->name);
+                    continue;
+                }
+
+                GameObjectLocale const* gl = sObjectMgr.GetGameObjectLocale(itr->id);
+                if (gl && (int32)gl->Name.size() > locale)
+                    index.Add(itr->id, gl->Name[locale]);
+            }
+            break;
+        }
+        case NAME_LOOKUP_QUEST:
+        {
+            ObjectMgr::QuestMap const& qTemplates = sObjectMgr.GetQuestTemplates();
+            for (ObjectMgr::QuestMap::const_iterator itr = qTemplates.begin(); itr != qTemplates.end(); ++itr)
+            {
+                std::string title;
+                if (locale >= 0)
+                    sObjectMgr.GetQuestLocaleStrings(itr->first, locale, &title);
+                else
+                    title = itr->second->GetTitle();
+
+                index.Add(itr->first, title);
+            }
+            break;
+        }
+        case NAME_LOOKUP_SPELL:
+        {
+            if (locale < 0 || locale >= MAX_LOCALE)
+                break;
+
+            for (uint32 id = 0; id < sSpellStore.GetNumRows(); ++id)
+                if (SpellEntry const* spellInfo = sSpellStore.LookupEntry(id))
+                    index.Add(id, spellInfo->SpellName[locale]);
+            break;
+        }
+    }
+}
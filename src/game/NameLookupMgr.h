@@ -0,0 +1,98 @@
+/*
+ * This file is part of the CMaNGOS Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef MANGOS_NAME_LOOKUP_MGR_H
+#define MANGOS_NAME_LOOKUP_MGR_H
+
+#include "Common.h"
+#include "Policies/Singleton.h"
+
+#include <vector>
+
+enum NameLookupType
+{
+    NAME_LOOKUP_ITEM        = 0,                            // item_template, locales_item
+    NAME_LOOKUP_CREATURE    = 1,                            // creature_template, locales_creature
+    NAME_LOOKUP_GAMEOBJECT  = 2,                            // gameobject_template, locales_gameobject
+    NAME_LOOKUP_QUEST       = 3,                            // quest_template, locales_quest
+    NAME_LOOKUP_SPELL       = 4,                            // Spell.dbc, by dbc locale
+};
+
+#define MAX_NAME_LOOKUP_TYPE 5
+
+/// Lowercased names of one lookup type in one locale, with a trigram index for substring search
+class NameLookupIndex
+{
+    public:
+        NameLookupIndex() {}
+
+        /// adds an utf8 name, empty names are skipped
+        void Add(uint32 id, std::string const& name);
+
+        /// appends ids of names containing the lowercased search string, in the order they were added
+        void Find(std::wstring const& search, std::vector<uint32>& ids) const;
+
+        size_t GetCount() const { return m_names.size(); }
+
+    private:
+        static uint64 MakeTrigram(wchar_t const* str)
+        {
+            return (uint64(str[0] & 0x1FFFFF) << 42) | (uint64(str[1] & 0x1FFFFF) << 21) | uint64(str[2] & 0x1FFFFF);
+        }
+
+        typedef std::vector<uint32> Postings;               // indexes in m_names, ascending
+        typedef UNORDERED_MAP<uint64, Postings> TrigramMap;
+
+        std::vector<uint32> m_ids;
+        std::vector<std::wstring> m_names;
+        TrigramMap m_trigrams;
+};
+
+/// id and the locale of the name that matched, -1 for the default DB name
+typedef std::pair<uint32, int> NameLookupMatch;
+typedef std::vector<NameLookupMatch> NameLookupMatches;
+
+/// Name indexes used by the GM lookup commands, built at first use of a type and locale
+class NameLookupMgr
+{
+    public:
+        NameLookupMgr() {}
+
+        /**
+         * Finds the entries of a type with a name containing the lowercased search string.
+         *
+         * @param locale    DB locale index (-1 for default) of the session, or its dbc locale for spells.
+         *                  The session locale is tried first, then the default name (other dbc locales for spells).
+         * @param matches   filled in ascending id order
+         */
+        void Find(NameLookupType type, int locale, std::wstring const& search, NameLookupMatches& matches);
+
+        /// drop the indexes of a type after its names were reloaded
+        void Clear(NameLookupType type) { m_indexes[type].clear(); }
+
+    private:
+        NameLookupIndex const& GetIndex(NameLookupType type, int locale);
+        void BuildIndex(NameLookupType type, int locale, NameLookupIndex& index) const;
+
+        typedef std::map<int, NameLookupIndex> LocaleIndexMap;
+        LocaleIndexMap m_indexes[MAX_NAME_LOOKUP_TYPE];
+};
+
+#define sNameLookupMgr MaNGOS::Singleton<NameLookupMgr>::Instance()
+
+#endif
@@ -42,6 +42,8 @@
 
 #define MAX_STEALTH_DETECT_RANGE    45.0f
 
+#define MAX_CHANGED_VALUES_JOURNAL  64                      // changed fields remembered by index, above this the whole value array is scanned
+
 enum TempSummonType
 {
     TEMPSUMMON_MANUAL_DESPAWN              = 0,             // despawns when UnSummon() is called
@@ -366,6 +368,18 @@ class MANGOS_DLL_SPEC Object
         void _InitValues();
         void _Create(uint32 guidlow, uint32 entry, HighGuid guidhigh);
 
+        void MarkValueChanged(uint16 index)
+        {
+            if (m_changedValues[index])
+                return;
+
+            m_changedValues[index] = true;
+            if (m_changedValuesJournal.size() < MAX_CHANGED_VALUES_JOURNAL)
+                m_changedValuesJournal.push_back(index);
+            else
+                m_changedValuesOverflow = true;
+        }
+
         virtual void _SetUpdateBits(UpdateMask* updateMask, Player* target) const;
 
         virtual void _SetCreateBits(UpdateMask* updateMask, Player* target) const;
@@ -387,6 +401,8 @@ class MANGOS_DLL_SPEC Object
         };
 
         std::vector<bool> m_changedValues;
+        std::vector<uint16> m_changedValuesJournal;         // indexes set in m_changedValues, complete unless m_changedValuesOverflow
+        bool m_changedValuesOverflow;
 
         uint16 m_valuesCount;
 
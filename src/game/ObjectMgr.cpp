@@ -1470,14 +1470,16 @@ void ObjectMgr::LoadCreatures()
             data.phaseMask = 1;
         }
 
+        bool active = false;
         if (gameEvent == 0 && GuidPoolId == 0 && EntryPoolId == 0) // if not this is to be managed by GameEvent System or Pool system
         {
             AddCreatureToGrid(guid, &data);
 
-            if (cInfo->ExtraFlags & CREATURE_FLAG_EXTRA_ACTIVE)
-                m_activeCreatures.insert(ActiveCreatureGuidsOnMap::value_type(data.mapid, guid));
+            active = cInfo->ExtraFlags & CREATURE_FLAG_EXTRA_ACTIVE;
         }
 
+        AddCreatureToPreloadGrids(&data, active);
+
         ++count;
     }
     while (result->NextRow());
@@ -1504,6 +1506,25 @@ void ObjectMgr::AddCreatureToGrid(uint32 guid, CreatureData const* data)
     }
 }
 
+void ObjectMgr::AddCreatureToPreloadGrids(CreatureData const* data, bool active)
+{
+    GridPair grid_pair = MaNGOS::ComputeGridPair(data->posX, data->posY);
+    uint32 grid_id = (grid_pair.y_coord * MAX_NUMBER_OF_GRIDS) + grid_pair.x_coord;
+    std::pair<float, float> pos(data->posX, data->posY);
+
+    uint8 mask = data->spawnMask;
+    for (uint8 i = 0; mask != 0; ++i, mask >>= 1)
+    {
+        if (mask & 1)
+        {
+            MapPreloadGrids& preloadGrids = mMapPreloadGrids[MAKE_PAIR32(data->mapid, i)];
+            preloadGrids.spawnGrids.insert(SpawnGridPositions::value_type(grid_id, pos));
+            if (active)
+                preloadGrids.activeGrids.insert(SpawnGridPositions::value_type(grid_id, pos));
+        }
+    }
+}
+
 void ObjectMgr::RemoveCreatureFromGrid(uint32 guid, CreatureData const* data)
 {
     uint8 mask = data->spawnMask;
@@ -2631,6 +2652,7 @@ void ObjectMgr::LoadItemExpireConverts()
 void ObjectMgr::LoadItemRequiredTarget()
 {
     m_ItemRequiredTarget.clear();                           // needed for reload case
+    ItemRequiredTargetMap::FreezeGuard freezeGuard(m_ItemRequiredTarget);
 
     uint32 count = 0;
 
@@ -3763,6 +3785,7 @@ void ObjectMgr::LoadQuests()
     mQuestTemplates.clear();
 
     m_ExclusiveQuestGroups.clear();
+    ExclusiveQuestGroupsMap::FreezeGuard freezeGuard(m_ExclusiveQuestGroups);
 
     //                                                0      1       2           3         4           5     6                7              8              9
     QueryResult* result = WorldDatabase.Query("SELECT entry, Method, ZoneOrSort, MinLevel, QuestLevel, Type, RequiredClasses, RequiredRaces, RequiredSkill, RequiredSkillValue,"
@@ -4688,6 +4711,7 @@ void ObjectMgr::LoadPageTextLocales()
 void ObjectMgr::LoadInstanceEncounters()
 {
     m_DungeonEncounters.clear();         // need for reload case
+    DungeonEncounterMap::FreezeGuard freezeGuard(m_DungeonEncounters);
 
     QueryResult* result = WorldDatabase.Query("SELECT entry, creditType, creditEntry, lastEncounterDungeon FROM instance_encounters");
 
@@ -6846,6 +6870,7 @@ void ObjectMgr::LoadNPCSpellClickSpells()
     uint32 count = 0;
 
     mSpellClickInfoMap.clear();
+    SpellClickInfoMap::FreezeGuard freezeGuard(mSpellClickInfoMap);
     //                                                0          1         2            3                   4          5           6
     QueryResult* result = WorldDatabase.Query("SELECT npc_entry, spell_id, quest_start, quest_start_active, quest_end, cast_flags, condition_id FROM npc_spellclick_spells");
 
@@ -7078,9 +7103,24 @@ void ObjectMgr::DeleteCorpseCellData(uint32 mapid, uint32 cellid, uint32 player_
     cell_guids.corpses.erase(player_guid);
 }
 
+void ObjectMgr::GetLookupTableMemory(size_t& flat, size_t& tree) const
+{
+    AddLookupTableMemory(mSpellClickInfoMap, flat, tree);
+    AddLookupTableMemory(m_ItemRequiredTarget, flat, tree);
+    AddLookupTableMemory(m_ExclusiveQuestGroups, flat, tree);
+    AddLookupTableMemory(m_CreatureQuestRelations, flat, tree);
+    AddLookupTableMemory(m_CreatureQuestInvolvedRelations, flat, tree);
+    AddLookupTableMemory(m_GOQuestRelations, flat, tree);
+    AddLookupTableMemory(m_GOQuestInvolvedRelations, flat, tree);
+    AddLookupTableMemory(m_mGossipMenusMap, flat, tree);
+    AddLookupTableMemory(m_mGossipMenuItemsMap, flat, tree);
+    AddLookupTableMemory(m_DungeonEncounters, flat, tree);
+}
+
 void ObjectMgr::LoadQuestRelationsHelper(QuestRelationsMap& map, char const* table)
 {
     map.clear();                                            // need for reload case
+    QuestRelationsMap::FreezeGuard freezeGuard(map);
 
     uint32 count = 0;
 
@@ -9109,25 +9149,18 @@ void ObjectMgr::LoadActiveEntities(Map* _map)
         return;
     }
 
-    // Load active objects for _map
+    // Load active objects for _map, grids are collected once per map and spawn mode at creature loading
+    MapPreloadGridsMap::const_iterator preloadGrids = mMapPreloadGrids.find(MAKE_PAIR32(_map->GetId(), _map->GetSpawnMode()));
+    if (preloadGrids == mMapPreloadGrids.end())
+        return;
+
     std::set<uint32> const* mapList = sWorld.getConfigForceLoadMapIds();
-    if (mapList && mapList->find(_map->GetId()) != mapList->end())
-    {
-        for (CreatureDataMap::const_iterator itr = mCreatureDataMap.begin(); itr != mCreatureDataMap.end(); ++itr)
-        {
-            if (itr->second.mapid == _map->GetId())
-                _map->ForceLoadGrid(itr->second.posX, itr->second.posY);
-        }
-    }
-    else                                                    // Normal case - Load all npcs that are active
-    {
-        std::pair<ActiveCreatureGuidsOnMap::const_iterator, ActiveCreatureGuidsOnMap::const_iterator> bounds = m_activeCreatures.equal_range(_map->GetId());
-        for (ActiveCreatureGuidsOnMap::const_iterator itr = bounds.first; itr != bounds.second; ++itr)
-        {
-            CreatureData const& data = mCreatureDataMap[itr->second];
-            _map->ForceLoadGrid(data.posX, data.posY);
-        }
-    }
+    bool forceLoad = mapList && mapList->find(_map->GetId()) != mapList->end();
+
+    // force loaded map - load all grids with npcs, normal case - load all npcs that are active
+    SpawnGridPositions const& grids = forceLoad ? preloadGrids->second.spawnGrids : preloadGrids->second.activeGrids;
+    for (SpawnGridPositions::const_iterator itr = grids.begin(); itr != grids.end(); ++itr)
+        _map->ForceLoadGrid(itr->second.first, itr->second.second);
 
     // Load Transports on Map _map
 }
@@ -9184,6 +9217,7 @@ void ObjectMgr::LoadNpcGossips()
 void ObjectMgr::LoadGossipMenu(std::set<uint32>& gossipScriptSet)
 {
     m_mGossipMenusMap.clear();
+    GossipMenusMap::FreezeGuard freezeGuard(m_mGossipMenusMap);
     //                                                0      1        2
     QueryResult* result = WorldDatabase.Query("SELECT entry, text_id, script_id, "
                           //   3
@@ -9253,6 +9287,8 @@ void ObjectMgr::LoadGossipMenu(std::set<uint32>& gossipScriptSet)
 
     delete result;
 
+    m_mGossipMenusMap.Freeze();
+
     // post loading tests
     for (uint32 i = 1; i < sCreatureStorage.GetMaxEntry(); ++i)
     {
@@ -9277,6 +9313,7 @@ void ObjectMgr::LoadGossipMenu(std::set<uint32>& gossipScriptSet)
 void ObjectMgr::LoadGossipMenuItems(std::set<uint32>& gossipScriptSet)
 {
     m_mGossipMenuItemsMap.clear();
+    GossipMenuItemsMap::FreezeGuard freezeGuard(m_mGossipMenuItemsMap);
 
     QueryResult* result = WorldDatabase.Query(
                               "SELECT menu_id, id, option_icon, option_text, option_id, npc_option_npcflag, "
@@ -36,6 +36,7 @@
 #include "ObjectAccessor.h"
 #include "ObjectGuid.h"
 #include "Policies/Singleton.h"
+#include "Utilities/FlatMultiMap.h"
 
 #include <string>
 #include <map>
@@ -72,7 +73,7 @@ struct SpellClickInfo
     bool IsFitToRequirements(Player const* player, Creature const* clickedCreature) const;
 };
 
-typedef std::multimap<uint32 /*npcEntry*/, SpellClickInfo> SpellClickInfoMap;
+typedef FlatMultiMap<uint32 /*npcEntry*/, SpellClickInfo> SpellClickInfoMap;
 typedef std::pair<SpellClickInfoMap::const_iterator, SpellClickInfoMap::const_iterator> SpellClickInfoMapBounds;
 
 struct AreaTrigger
@@ -115,6 +116,17 @@ struct CellObjectGuids
 typedef UNORDERED_MAP < uint32/*cell_id*/, CellObjectGuids > CellObjectGuidsMap;
 typedef UNORDERED_MAP < uint32/*(mapid,spawnMode) pair*/, CellObjectGuidsMap > MapObjectGuids;
 
+typedef std::map < uint32/*grid id*/, std::pair<float, float>/*a spawn position inside the grid*/ > SpawnGridPositions;
+
+// grids to load at map creation, resolved once per (map, spawn mode) and shared by all its instances
+// only the grid list is shared: creatures and gameobjects are still created one by one at grid load
+struct MapPreloadGrids
+{
+    SpawnGridPositions activeGrids;                         // grids with active creatures
+    SpawnGridPositions spawnGrids;                          // grids with any creature, used for force loaded maps
+};
+typedef UNORDERED_MAP < uint32/*(mapid,spawnMode) pair*/, MapPreloadGrids > MapPreloadGridsMap;
+
 // mangos string ranges
 #define MIN_MANGOS_STRING_ID           1                    // 'mangos_string'
 #define MAX_MANGOS_STRING_ID           2000000000
@@ -194,9 +206,9 @@ typedef UNORDERED_MAP<uint32, GossipMenuItemsLocale> GossipMenuItemsLocaleMap;
 typedef UNORDERED_MAP<uint32, PointOfInterestLocale> PointOfInterestLocaleMap;
 typedef UNORDERED_MAP<uint32, uint32> ItemConvertMap;
 
-typedef std::multimap<int32, uint32> ExclusiveQuestGroupsMap;
-typedef std::multimap<uint32, ItemRequiredTarget> ItemRequiredTargetMap;
-typedef std::multimap<uint32, uint32> QuestRelationsMap;
+typedef FlatMultiMap<int32, uint32> ExclusiveQuestGroupsMap;
+typedef FlatMultiMap<uint32, ItemRequiredTarget> ItemRequiredTargetMap;
+typedef FlatMultiMap<uint32, uint32> QuestRelationsMap;
 typedef std::pair<ExclusiveQuestGroupsMap::const_iterator, ExclusiveQuestGroupsMap::const_iterator> ExclusiveQuestGroupsMapBounds;
 typedef std::pair<ItemRequiredTargetMap::const_iterator, ItemRequiredTargetMap::const_iterator> ItemRequiredTargetMapBounds;
 typedef std::pair<QuestRelationsMap::const_iterator, QuestRelationsMap::const_iterator> QuestRelationsMapBounds;
@@ -288,9 +300,9 @@ struct GossipMenus
     uint16          conditionId;
 };
 
-typedef std::multimap<uint32, GossipMenus> GossipMenusMap;
+typedef FlatMultiMap<uint32, GossipMenus> GossipMenusMap;
 typedef std::pair<GossipMenusMap::const_iterator, GossipMenusMap::const_iterator> GossipMenusMapBounds;
-typedef std::multimap<uint32, GossipMenuItems> GossipMenuItemsMap;
+typedef FlatMultiMap<uint32, GossipMenuItems> GossipMenuItemsMap;
 typedef std::pair<GossipMenuItemsMap::const_iterator, GossipMenuItemsMap::const_iterator> GossipMenuItemsMapBounds;
 
 struct QuestPOIPoint
@@ -343,7 +355,7 @@ struct DungeonEncounter
     uint32 lastEncounterDungeon;
 };
 
-typedef std::multimap<uint32, DungeonEncounter const*> DungeonEncounterMap;
+typedef FlatMultiMap<uint32, DungeonEncounter const*> DungeonEncounterMap;
 typedef std::pair<DungeonEncounterMap::const_iterator, DungeonEncounterMap::const_iterator> DungeonEncounterMapBounds;
 
 struct GraveYardData
@@ -752,6 +764,9 @@ class ObjectMgr
 
         void LoadGossipMenus();
 
+        // memory of the frozen lookup tables, and an estimate for the same data in std::multimap
+        void GetLookupTableMemory(size_t& flat, size_t& tree) const;
+
         void LoadVendorTemplates();
         void LoadVendors() { LoadVendors("npc_vendor", false); }
         void LoadTrainerTemplates();
@@ -1219,6 +1234,7 @@ class ObjectMgr
         void LoadQuestRelationsHelper(QuestRelationsMap& map, char const* table);
         void LoadVendors(char const* tableName, bool isTemplates);
         void LoadTrainers(char const* tableName, bool isTemplates);
+        void AddCreatureToPreloadGrids(CreatureData const* data, bool active);
 
         void LoadGossipMenu(std::set<uint32>& gossipScriptSet);
         void LoadGossipMenuItems(std::set<uint32>& gossipScriptSet);
@@ -1247,13 +1263,11 @@ class ObjectMgr
         HalfNameMap PetHalfName0;
         HalfNameMap PetHalfName1;
 
-        typedef std::multimap<uint32 /*mapId*/, uint32 /*guid*/> ActiveCreatureGuidsOnMap;
-
         // Array to store creature stats, Max creature level + 1 (for data alignement with in game level)
         CreatureClassLvlStats m_creatureClassLvlStats[DEFAULT_MAX_CREATURE_LEVEL + 1][MAX_CREATURE_CLASS][MAX_EXPANSION + 1];
 
         MapObjectGuids mMapObjectGuids;
-        ActiveCreatureGuidsOnMap m_activeCreatures;
+        MapPreloadGridsMap mMapPreloadGrids;
         CreatureDataMap mCreatureDataMap;
         CreatureLocaleMap mCreatureLocaleMap;
         GameObjectDataMap mGameObjectDataMap;
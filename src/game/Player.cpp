@@ -4319,6 +4319,9 @@ void Player::DeleteFromDB(ObjectGuid playerguid, uint32 accountId, bool updateRe
             sLog.outError("Player::DeleteFromDB: Unsupported delete method: %u.", charDelete_method);
     }
 
+    if (accountId)
+        sWorld.InvalidateCharEnum(accountId);
+
     if (updateRealmChars)
         sWorld.UpdateRealmCharCount(accountId);
 }
@@ -17967,6 +17970,8 @@ void Player::SavePositionInDB(ObjectGuid guid, uint32 mapid, float x, float y, f
        << "transguid='0',taxi_path='' WHERE guid='" << guid.GetCounter() << "'";
     DEBUG_LOG("%s", ss.str().c_str());
     CharacterDatabase.Execute(ss.str().c_str());
+
+    sWorld.InvalidateCharEnumOf(guid);
 }
 
 void Player::SetUInt32ValueInArray(Tokens& tokens, uint16 index, uint32 value)
@@ -74,6 +74,8 @@ struct FriendInfo
 
 typedef std::map<uint32, FriendInfo> PlayerSocialMap;
 typedef std::map<uint32, PlayerSocial> SocialMap;
+typedef std::set<uint32> SocialListerSet;
+typedef std::map<uint32, SocialListerSet> SocialListerMap;    // player low guid -> loaded players who have this character as a friend
 
 /// Results of friend related commands
 enum FriendsResult
@@ -134,11 +136,12 @@ class PlayerSocial
 
 class SocialMgr
 {
+        friend class PlayerSocial;
     public:
         SocialMgr();
         ~SocialMgr();
         // Misc
-        void RemovePlayerSocial(uint32 guid) { m_socialMap.erase(guid); }
+        void RemovePlayerSocial(uint32 guid);
 
         void GetFriendInfo(Player* player, uint32 friendGUID, FriendInfo& friendInfo);
         // Packet management
@@ -148,7 +151,13 @@ class SocialMgr
         // Loading
         PlayerSocial* LoadFromDB(QueryResult* result, ObjectGuid guid);
     private:
+        // reverse friend index, kept in sync with friend flags of loaded socials
+        void AddFriendLister(uint32 friend_lowguid, uint32 lister_lowguid);
+        void RemoveFriendLister(uint32 friend_lowguid, uint32 lister_lowguid);
+        void RemoveAllFriendListers(PlayerSocial const& social);
+
         SocialMap m_socialMap;
+        SocialListerMap m_friendListers;
 };
 
 #define sSocialMgr MaNGOS::Singleton<SocialMgr>::Instance()
@@ -2822,6 +2822,7 @@ void SpellMgr::LoadSpellChains()
 {
     mSpellChains.clear();                                   // need for reload case
     mSpellChainsNext.clear();                               // need for reload case
+    SpellChainMapNext::FreezeGuard freezeGuard(mSpellChainsNext);
 
     // load known data for talents
     for (unsigned int i = 0; i < sTalentStore.GetNumRows(); ++i)
@@ -3169,6 +3170,8 @@ void SpellMgr::LoadSpellChains()
             mSpellChainsNext.insert(SpellChainMapNext::value_type(node.req, spell_id));
     }
 
+    mSpellChainsNext.Freeze();
+
     // check single rank redundant cases (single rank talents/spell abilities not added by default so this can be only custom cases)
     for (SpellChainMap::const_iterator i = mSpellChains.begin(); i != mSpellChains.end(); ++i)
     {
@@ -3229,6 +3232,10 @@ void SpellMgr::LoadSpellLearnSkills()
 void SpellMgr::LoadSpellLearnSpells()
 {
     mSpellLearnSpells.clear();                              // need for reload case
+    SpellLearnSpellMap::FreezeGuard freezeGuard(mSpellLearnSpells);
+
+    // learning pairs already added, the map is not searchable while loading
+    std::set<std::pair<uint32, uint32> > learnPairs;
 
     //                                                0      1        2
     QueryResult* result = WorldDatabase.Query("SELECT entry, SpellID, Active FROM spell_learn_spell");
@@ -3277,6 +3284,7 @@ void SpellMgr::LoadSpellLearnSpells()
         }
 
         mSpellLearnSpells.insert(SpellLearnSpellMap::value_type(spell_id, node));
+        learnPairs.insert(std::pair<uint32, uint32>(spell_id, node.spell));
 
         ++count;
     }
@@ -3310,21 +3318,10 @@ void SpellMgr::LoadSpellLearnSpells()
                 // other required explicit dependent learning
                 dbc_node.autoLearned = entry->EffectImplicitTargetA[i] == TARGET_PET || GetTalentSpellCost(spell) > 0 || IsPassiveSpell(entry) || IsSpellHaveEffect(entry, SPELL_EFFECT_SKILL_STEP);
 
-                SpellLearnSpellMapBounds db_node_bounds = GetSpellLearnSpellMapBounds(spell);
-
-                bool found = false;
-                for (SpellLearnSpellMap::const_iterator itr = db_node_bounds.first; itr != db_node_bounds.second; ++itr)
-                {
-                    if (itr->second.spell == dbc_node.spell)
-                    {
-                        sLog.outErrorDb("Spell %u auto-learn spell %u in spell.dbc then the record in `spell_learn_spell` is redundant, please fix DB.",
-                                        spell, dbc_node.spell);
-                        found = true;
-                        break;
-                    }
-                }
-
-                if (!found)                                 // add new spell-spell pair if not found
+                if (!learnPairs.insert(std::pair<uint32, uint32>(spell, dbc_node.spell)).second)
+                    sLog.outErrorDb("Spell %u auto-learn spell %u in spell.dbc then the record in `spell_learn_spell` is redundant, please fix DB.",
+                                    spell, dbc_node.spell);
+                else                                        // add new spell-spell pair if not found
                 {
                     mSpellLearnSpells.insert(SpellLearnSpellMap::value_type(spell, dbc_node));
                     ++dbc_count;
@@ -3805,6 +3802,12 @@ void SpellMgr::LoadSpellAreas()
 {
     mSpellAreaMap.clear();                                  // need for reload case
     mSpellAreaForAuraMap.clear();
+    mSpellAreaForAreaMap.clear();
+    SpellAreaForAuraMap::FreezeGuard auraFreezeGuard(mSpellAreaForAuraMap);
+    SpellAreaForAreaMap::FreezeGuard areaFreezeGuard(mSpellAreaForAreaMap);
+
+    // spells autocast from an aura, the by aura map is not searchable while loading
+    std::set<uint32> autocastAuraSpells;
 
     uint32 count = 0;
 
@@ -3953,16 +3956,7 @@ void SpellMgr::LoadSpellAreas()
             // not allow autocast chains by auraSpell field (but allow use as alternative if not present)
             if (spellArea.autocast && spellArea.auraSpell > 0)
             {
-                bool chain = false;
-                SpellAreaForAuraMapBounds saBound = GetSpellAreaForAuraMapBounds(spellArea.spellId);
-                for (SpellAreaForAuraMap::const_iterator itr = saBound.first; itr != saBound.second; ++itr)
-                {
-                    if (itr->second->autocast && itr->second->auraSpell > 0)
-                    {
-                        chain = true;
-                        break;
-                    }
-                }
+                bool chain = autocastAuraSpells.find(spellArea.spellId) != autocastAuraSpells.end();
 
                 if (chain)
                 {
@@ -3998,6 +3992,9 @@ void SpellMgr::LoadSpellAreas()
         if (spellArea.auraSpell)
             mSpellAreaForAuraMap.insert(SpellAreaForAuraMap::value_type(abs(spellArea.auraSpell), sa));
 
+        if (spellArea.autocast && spellArea.auraSpell > 0)
+            autocastAuraSpells.insert(spellArea.auraSpell);
+
         ++count;
     }
     while (result->NextRow());
@@ -4151,6 +4148,7 @@ SpellCastResult SpellMgr::GetSpellAllowedInLocationError(SpellEntry const* spell
 void SpellMgr::LoadSkillLineAbilityMap()
 {
     mSkillLineAbilityMap.clear();
+    SkillLineAbilityMap::FreezeGuard freezeGuard(mSkillLineAbilityMap);
 
     BarGoLink bar(sSkillLineAbilityStore.GetNumRows());
     uint32 count = 0;
@@ -4170,9 +4168,20 @@ void SpellMgr::LoadSkillLineAbilityMap()
     sLog.outString();
 }
 
+void SpellMgr::GetLookupTableMemory(size_t& flat, size_t& tree) const
+{
+    AddLookupTableMemory(mSpellChainsNext, flat, tree);
+    AddLookupTableMemory(mSpellLearnSpells, flat, tree);
+    AddLookupTableMemory(mSkillLineAbilityMap, flat, tree);
+    AddLookupTableMemory(mSkillRaceClassInfoMap, flat, tree);
+    AddLookupTableMemory(mSpellAreaForAuraMap, flat, tree);
+    AddLookupTableMemory(mSpellAreaForAreaMap, flat, tree);
+}
+
 void SpellMgr::LoadSkillRaceClassInfoMap()
 {
     mSkillRaceClassInfoMap.clear();
+    SkillRaceClassInfoMap::FreezeGuard freezeGuard(mSkillRaceClassInfoMap);
 
     BarGoLink bar(sSkillRaceClassInfoStore.GetNumRows());
     uint32 count = 0;
@@ -161,6 +161,37 @@ void MovementInfo::Write(ByteBuffer& data) const
     }
 }
 
+bool MovementInfo::HasValidCoordinates() const
+{
+    if (!MaNGOS::IsValidMapCoord(pos.x, pos.y, pos.z, pos.o))
+        return false;
+
+    if (HasMovementFlag(MOVEFLAG_ONTRANSPORT))
+    {
+        // transports size limited
+        // (also received at zeppelin/lift leave by some reason with t_* as absolute in continent coordinates, can be safely skipped)
+        if (t_pos.x > 50 || t_pos.y > 50 || t_pos.z > 100)
+            return false;
+
+        if (!MaNGOS::IsValidMapCoord(pos.x + t_pos.x, pos.y + t_pos.y, pos.z + t_pos.z, pos.o + t_pos.o))
+            return false;
+    }
+
+    return true;
+}
+
+////////////////////////////////////////////////////////////
+// Methods of class MovementPacket
+
+bool MovementPacket::Decode()
+{
+    *this >> m_moverGuid.ReadAsPacked();
+    *this >> m_movementInfo;
+
+    m_decoded = m_movementInfo.HasValidCoordinates();
+    return m_decoded;
+}
+
 ////////////////////////////////////////////////////////////
 // Methods of class GlobalCooldownMgr
 
@@ -11222,18 +11253,27 @@ void Unit::UpdateSplineMovement(uint32 t_diff)
         DisableSpline();
 
     m_movesplineTimer.Update(t_diff);
-    if (m_movesplineTimer.Passed() || arrived)
+    if (arrived)
     {
+        // final position is applied at once, arrival handling expects it
         m_movesplineTimer.Reset(POSITION_UPDATE_DELAY);
-        Movement::Location loc = movespline->ComputePosition();
-
-        if (IsBoarded())
-            GetTransportInfo()->SetLocalPosition(loc.x, loc.y, loc.z, loc.orientation);
-        else if (GetTypeId() == TYPEID_PLAYER)
-            ((Player*)this)->SetPosition(loc.x, loc.y, loc.z, loc.orientation);
-        else
-            GetMap()->CreatureRelocation((Creature*)this, loc.x, loc.y, loc.z, loc.orientation);
+        RelocateBySpline(movespline->ComputePosition());
     }
+    else if (m_movesplineTimer.Passed())
+    {
+        m_movesplineTimer.Reset(POSITION_UPDATE_DELAY);
+        GetMap()->ScheduleSplineRelocation(this);
+    }
+}
+
+void Unit::RelocateBySpline(Movement::Location const& loc)
+{
+    if (IsBoarded())
+        GetTransportInfo()->SetLocalPosition(loc.x, loc.y, loc.z, loc.orientation);
+    else if (GetTypeId() == TYPEID_PLAYER)
+        ((Player*)this)->SetPosition(loc.x, loc.y, loc.z, loc.orientation);
+    else
+        GetMap()->CreatureRelocation((Creature*)this, loc.x, loc.y, loc.z, loc.orientation);
 }
 
 void Unit::DisableSpline()
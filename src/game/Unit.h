@@ -692,6 +692,9 @@ class MovementInfo
         void Read(ByteBuffer& data);
         void Write(ByteBuffer& data) const;
 
+        // Position checks, done on the network thread for pre-decoded packets
+        bool HasValidCoordinates() const;
+
         // Movement flags manipulations
         void AddMovementFlag(MovementFlags f) { moveFlags |= f; }
         void RemoveMovementFlag(MovementFlags f) { moveFlags &= ~f; }
@@ -773,9 +776,33 @@ inline ByteBuffer& operator>> (ByteBuffer& buf, MovementInfo& mi)
     return buf;
 }
 
+/**
+ * Received movement packet (handled by WorldSession::HandleMovementOpcodes).
+ * It is decoded and validated by the network thread before it is queued to
+ * the session, so malformed movement never reaches the map update.
+ */
+class MovementPacket : public WorldPacket
+{
+    public:
+        MovementPacket(Opcodes opcode, size_t res) : WorldPacket(opcode, res), m_decoded(false) {}
+
+        /// Read mover guid and movement info, false if the position is unusable. Throws ByteBufferException on malformed data.
+        bool Decode();
+
+        bool IsDecoded() const { return m_decoded; }
+        ObjectGuid const& GetMoverGuid() const { return m_moverGuid; }
+        MovementInfo const& GetMovementInfo() const { return m_movementInfo; }
+
+    private:
+        bool m_decoded;
+        ObjectGuid m_moverGuid;
+        MovementInfo m_movementInfo;
+};
+
 namespace Movement
 {
     class MoveSpline;
+    struct Location;
 }
 
 /**
@@ -2096,6 +2123,7 @@ class MANGOS_DLL_SPEC Unit : public WorldObject
         // Movement info
         MovementInfo m_movementInfo;
         Movement::MoveSpline* movespline;
+        void RelocateBySpline(Movement::Location const& loc);
 
         void ScheduleAINotify(uint32 delay);
         bool IsAINotifyScheduled() const { return m_AINotifyScheduled;}
@@ -48,6 +48,11 @@ class UpdateMask
             return (((uint8*)mUpdateMask)[ index >> 3 ] & (1 << (index & 0x7))) != 0;
         }
 
+        /// First set bit, GetCount() if none
+        uint32 GetFirstBit() const { return FindBit(0); }
+        /// Next set bit after index, GetCount() if none
+        uint32 GetNextBit(uint32 index) const { return FindBit(index + 1); }
+
         uint32 GetBlockCount() const { return mBlocks; }
         uint32 GetLength() const { return mBlocks << 2; }
         uint32 GetCount() const { return mCount; }
@@ -115,6 +120,24 @@ class UpdateMask
         }
 
     private:
+        // empty blocks and bytes are skipped whole, a mask with a few bits set is walked in about GetBlockCount() steps
+        uint32 FindBit(uint32 index) const
+        {
+            uint8 const* mask = (uint8 const*)mUpdateMask;
+            while (index < mCount)
+            {
+                if (!(index & 0x1F) && !mUpdateMask[index >> 5])
+                    index += 32;
+                else if (!(index & 0x7) && !mask[index >> 3])
+                    index += 8;
+                else if (mask[index >> 3] & (1 << (index & 0x7)))
+                    return index;
+                else
+                    ++index;
+            }
+            return mCount;
+        }
+
         uint32 mCount;
         uint32 mBlocks;
         uint32* mUpdateMask;
@@ -98,6 +98,8 @@ World::World()
     m_startTime = m_gameTime;
     m_maxActiveSessionCount = 0;
     m_maxQueuedSessionCount = 0;
+    m_sendBatching = 0;
+    m_sendBatchingThread = ACE_OS::NULL_thread;
     m_NextDailyQuestReset = 0;
     m_NextWeeklyQuestReset = 0;
 
@@ -279,6 +281,9 @@ World::AddSession_(WorldSession* s)
 
     s->SendTutorialsData();
 
+    // the character screen follows, have the list ready for it
+    s->LoadCharEnum();
+
     UpdateMaxSessionCounters();
 
     // Updates the population
@@ -368,6 +373,7 @@ bool World::RemoveQueuedSession(WorldSession* sess)
 
         pop_sess->SendAccountDataTimes(GLOBAL_CACHE_MASK);
         pop_sess->SendTutorialsData();
+        pop_sess->LoadCharEnum();
 
         m_QueuedSessions.pop_front();
 
@@ -714,6 +720,7 @@ void World::LoadConfigSettings(bool reload)
     setConfig(CONFIG_UINT32_CHATFLOOD_MUTE_TIME,     "ChatFlood.MuteTime", 10);
 
     setConfig(CONFIG_BOOL_EVENT_ANNOUNCE, "Event.Announce", false);
+    setConfig(CONFIG_UINT32_EVENT_SPAWN_PER_TICK, "Event.SpawnPerTick", 0);
 
     setConfig(CONFIG_UINT32_CREATURE_FAMILY_ASSISTANCE_DELAY, "CreatureFamilyAssistanceDelay", 1500);
     setConfig(CONFIG_UINT32_CREATURE_FAMILY_FLEE_DELAY,       "CreatureFamilyFleeDelay",       7000);
@@ -793,6 +800,7 @@ void World::LoadConfigSettings(bool reload)
     setConfig(CONFIG_BOOL_OFFHAND_CHECK_AT_TALENTS_RESET, "OffhandCheckAtTalentsReset", false);
 
     setConfig(CONFIG_BOOL_KICK_PLAYER_ON_BAD_PACKET, "Network.KickOnBadPacket", false);
+    setConfig(CONFIG_BOOL_NETWORK_FLUSH_ON_TICK, "Network.FlushOnTick", false);
 
     setConfig(CONFIG_BOOL_PLAYER_COMMANDS, "PlayerCommands", true);
 
@@ -822,6 +830,13 @@ void World::LoadConfigSettings(bool reload)
 
     setConfig(CONFIG_BOOL_PET_UNSUMMON_AT_MOUNT,      "PetUnsummonAtMount", true);
 
+    setConfig(CONFIG_BOOL_MOVEMENT_RELAY_COALESCE, "Visibility.MovementRelay.Coalesce", false);
+    setConfigMin(CONFIG_FLOAT_MOVEMENT_RELAY_FAR_DISTANCE, "Visibility.MovementRelay.FarDistance", 0.0f, 0.0f);
+    setConfig(CONFIG_UINT32_MOVEMENT_RELAY_FAR_INTERVAL, "Visibility.MovementRelay.FarInterval", 500);
+
+    setConfigMin(CONFIG_FLOAT_IDLE_UPDATE_DISTANCE, "Visibility.IdleUpdate.Distance", 0.0f, 0.0f);
+    setConfig(CONFIG_UINT32_IDLE_UPDATE_INTERVAL, "Visibility.IdleUpdate.Interval", 1000);
+
     m_relocation_ai_notify_delay = sConfig.GetIntDefault("Visibility.AIRelocationNotifyDelay", 1000u);
     m_relocation_lower_limit_sq  = pow(sConfig.GetFloatDefault("Visibility.RelocationLowerLimit", 10), 2);
 
@@ -1466,6 +1481,13 @@ void World::SetInitialWorldSettings()
     sAuctionBot.Initialize();
     sLog.outString();
 
+    size_t lookupFlat = 0;
+    size_t lookupTree = 0;
+    sSpellMgr.GetLookupTableMemory(lookupFlat, lookupTree);
+    sObjectMgr.GetLookupTableMemory(lookupFlat, lookupTree);
+    sLog.outString("Static lookup tables use " SIZEFMTD " KB as sorted arrays, about " SIZEFMTD " KB as trees", lookupFlat / 1024, lookupTree / 1024);
+    sLog.outString();
+
     sLog.outString("---------------------------------------");
     sLog.outString("      CMANGOS: World initialized       ");
     sLog.outString("---------------------------------------");
@@ -1534,6 +1556,13 @@ void World::Update(uint32 diff)
             m_timers[i].SetCurrent(0);
     }
 
+    ///- Stage packets sent during this tick, they are handed to the sockets in one batch at its end
+    if (getConfig(CONFIG_BOOL_NETWORK_FLUSH_ON_TICK))
+    {
+        m_sendBatchingThread = ACE_OS::thr_self();
+        m_sendBatching = 1;
+    }
+
     ///- Update the game time and check for shutdown time
     _UpdateGameTime();
 
@@ -1606,6 +1635,8 @@ void World::Update(uint32 diff)
 
         m_timers[WUPDATE_UPTIME].Reset();
         LoginDatabase.PExecute("UPDATE uptime SET uptime = %u, maxplayers = %u WHERE realmid = %u AND starttime = " UI64FMTD, tmpDiff, maxClientsNum, realmID, uint64(m_startTime));
+
+        _LogUpdateStats();
     }
 
     /// <li> Handle all other objects
@@ -1641,6 +1672,9 @@ void World::Update(uint32 diff)
         m_timers[WUPDATE_EVENTS].Reset();
     }
 
+    ///- Apply the queued spawn changes of started and stopped game events
+    sGameEventMgr.UpdateTransitions();
+
     /// </ul>
     ///- Move all creatures with "delayed move" and remove and delete all objects with "delayed remove"
     sMapMgr.RemoveAllObjectsInRemoveList();
@@ -1653,6 +1687,9 @@ void World::Update(uint32 diff)
 
     // cleanup unused GridMap objects as well as VMaps
     sTerrainMgr.Update(diff);
+
+    // send the packets staged during this tick
+    FlushSessionPackets();
 }
 
 namespace MaNGOS
@@ -1894,6 +1931,27 @@ bool World::RemoveBanAccount(BanMode mode, std::string nameOrIP)
     return true;
 }
 
+static void LogUpdateTimeStats(char const* name, UpdateTimeStats const& stats)
+{
+    DETAIL_LOG("%s: %u runs in %u ms, longest %u ms", name, stats.count, stats.totalTime, stats.maxTime);
+}
+
+/// Log and reset the update counters collected since the last uptime update
+void World::_LogUpdateStats()
+{
+    uint32 relayed, coalesced, farSkipped;
+    WorldSession::GetMovementRelayStats(relayed, coalesced, farSkipped);
+    DETAIL_LOG("Movement relay: %u relayed, %u coalesced, %u far observer updates skipped", relayed, coalesced, farSkipped);
+
+    uint32 fullUpdates, idleUpdates, deferredUpdates;
+    Map::GetCreatureUpdateStats(fullUpdates, idleUpdates, deferredUpdates);
+    DETAIL_LOG("Creature updates: %u full rate, %u idle rate, %u deferred", fullUpdates, idleUpdates, deferredUpdates);
+
+    LogUpdateTimeStats("Instance creation", sMapMgr.GetInstanceCreationStats());
+    LogUpdateTimeStats("Auction expiry", sAuctionMgr.GetUpdateStats());
+    LogUpdateTimeStats("AHBot", sAuctionBot.GetUpdateStats());
+}
+
 /// Update the game time
 void World::_UpdateGameTime()
 {
@@ -2015,6 +2073,22 @@ void World::UpdateSessions(uint32 /*diff*/)
     }
 }
 
+bool World::IsSendBatching() const
+{
+    return m_sendBatching.value() && ACE_OS::thr_equal(ACE_OS::thr_self(), m_sendBatchingThread);
+}
+
+void World::FlushSessionPackets()
+{
+    if (!m_sendBatching.value())
+        return;
+
+    m_sendBatching = 0;
+
+    for (SessionMap::const_iterator itr = m_sessions.begin(); itr != m_sessions.end(); ++itr)
+        itr->second->FlushPackets();
+}
+
 // This handles the issued and queued CLI/RA commands
 void World::ProcessCliCommands()
 {
@@ -2421,3 +2495,16 @@ void World::InvalidatePlayerDataToAllClient(ObjectGuid guid)
     data << guid;
     SendGlobalMessage(&data);
 }
+
+void World::InvalidateCharEnum(uint32 accountId)
+{
+    if (WorldSession* session = FindSession(accountId))
+        session->InvalidateCharEnum();
+}
+
+void World::InvalidateCharEnumOf(ObjectGuid guid)
+{
+    for (SessionMap::const_iterator itr = m_sessions.begin(); itr != m_sessions.end(); ++itr)
+        if (itr->second->IsCharEnumListing(guid.GetCounter()))
+            itr->second->InvalidateCharEnum();
+}
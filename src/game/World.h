@@ -27,6 +27,7 @@
 #include "Timer.h"
 #include "Policies/Singleton.h"
 #include "SharedDefines.h"
+#include "ace/Atomic_Op.h"
 
 #include <map>
 #include <set>
@@ -135,6 +136,7 @@ enum eConfigUInt32Values
     CONFIG_UINT32_GROUP_VISIBILITY,
     CONFIG_UINT32_MAIL_DELIVERY_DELAY,
     CONFIG_UINT32_MASS_MAILER_SEND_PER_TICK,
+    CONFIG_UINT32_EVENT_SPAWN_PER_TICK,
     CONFIG_UINT32_UPTIME_UPDATE,
     CONFIG_UINT32_AUCTION_DEPOSIT_MIN,
     CONFIG_UINT32_SKILL_CHANCE_ORANGE,
@@ -192,6 +194,8 @@ enum eConfigUInt32Values
     CONFIG_UINT32_GUID_RESERVE_SIZE_GAMEOBJECT,
     CONFIG_UINT32_MIN_LEVEL_FOR_RAID,
     CONFIG_UINT32_CREATURE_RESPAWN_AGGRO_DELAY,
+    CONFIG_UINT32_MOVEMENT_RELAY_FAR_INTERVAL,
+    CONFIG_UINT32_IDLE_UPDATE_INTERVAL,
     CONFIG_UINT32_VALUE_COUNT
 };
 
@@ -278,6 +282,8 @@ enum eConfigFloatValues
     CONFIG_FLOAT_THREAT_RADIUS,
     CONFIG_FLOAT_GHOST_RUN_SPEED_WORLD,
     CONFIG_FLOAT_GHOST_RUN_SPEED_BG,
+    CONFIG_FLOAT_MOVEMENT_RELAY_FAR_DISTANCE,
+    CONFIG_FLOAT_IDLE_UPDATE_DISTANCE,
     CONFIG_FLOAT_VALUE_COUNT
 };
 
@@ -341,6 +347,8 @@ enum eConfigBoolValues
     CONFIG_BOOL_OUTDOORPVP_NA_ENABLED,
     CONFIG_BOOL_OUTDOORPVP_GH_ENABLED,
     CONFIG_BOOL_KICK_PLAYER_ON_BAD_PACKET,
+    CONFIG_BOOL_NETWORK_FLUSH_ON_TICK,
+    CONFIG_BOOL_MOVEMENT_RELAY_COALESCE,
     CONFIG_BOOL_STATS_SAVE_ONLY_ON_LOGOUT,
     CONFIG_BOOL_CLEAN_CHARACTER_DB,
     CONFIG_BOOL_VMAP_INDOOR_CHECK,
@@ -466,6 +474,8 @@ class World
         /// Get the maximum number of parallel sessions on the server since last reboot
         uint32 GetMaxQueuedSessionCount() const { return m_maxQueuedSessionCount; }
         uint32 GetMaxActiveSessionCount() const { return m_maxActiveSessionCount; }
+        /// True if packets sent from the calling thread are staged until the end of the world tick
+        bool IsSendBatching() const;
         Player* FindPlayerInZone(uint32 zone);
 
         Weather* FindWeather(uint32 id) const;
@@ -611,8 +621,14 @@ class World
         **/
         void InvalidatePlayerDataToAllClient(ObjectGuid guid);
 
+        /// Drop the cached character list of the account session, if it is online
+        void InvalidateCharEnum(uint32 accountId);
+        /// Drop the cached character list of the session listing this character, the account is not known
+        void InvalidateCharEnumOf(ObjectGuid guid);
+
     protected:
         void _UpdateGameTime();
+        void _LogUpdateStats();
         // callback for UpdateRealmCharacters
         void _UpdateRealmCharCount(QueryResult* resultCharCount, uint32 accountId);
 
@@ -655,6 +671,9 @@ class World
         WeatherMap m_weathers;
         typedef UNORDERED_MAP<uint32, WorldSession*> SessionMap;
         SessionMap m_sessions;
+        ACE_Atomic_Op<ACE_Thread_Mutex, long> m_sendBatching; // sessions stage outgoing packets until FlushSessionPackets(), read by network threads
+        ACE_thread_t m_sendBatchingThread;                  // only the world thread stages, others send directly
+        void FlushSessionPackets();
         uint32 m_maxActiveSessionCount;
         uint32 m_maxQueuedSessionCount;
 
@@ -81,7 +81,9 @@ bool WorldSessionFilter::Process(WorldPacket* packet)
 
 /// WorldSession constructor
 WorldSession::WorldSession(uint32 id, WorldSocket* sock, AccountTypes sec, uint8 expansion, time_t mute_time, LocaleConstant locale) :
-    m_muteTime(mute_time), _player(NULL), m_Socket(sock), _security(sec), _accountId(id), m_expansion(expansion), _logoutTime(0),
+    m_muteTime(mute_time), _player(NULL), m_Socket(sock), m_movementRelay(NULL), m_movementRelayFarTime(0),
+    m_charEnum(NULL), m_charEnumQuery(0), m_charEnumLoading(false), m_charEnumStale(false), m_charEnumRequested(false),
+    _security(sec), _accountId(id), m_expansion(expansion), _logoutTime(0),
     m_inQueue(false), m_playerLoading(false), m_playerLogout(false), m_playerRecentlyLogout(false), m_playerSave(false),
     m_sessionDbcLocale(sWorld.GetAvailableDbcLocale(locale)), m_sessionDbLocaleIndex(sObjectMgr.GetIndexForLocale(locale)),
     m_latency(0), m_tutorialState(TUTORIALDATA_UNCHANGED)
@@ -103,11 +105,16 @@ WorldSession::~WorldSession()
     /// - If have unclosed socket, close it
     if (m_Socket)
     {
+        FlushPackets();
+
         m_Socket->CloseSocket();
         m_Socket->RemoveReference();
         m_Socket = NULL;
     }
 
+    delete m_movementRelay;
+    delete m_charEnum;
+
     ///- empty incoming packet queue
     WorldPacket* packet = NULL;
     while (_recvQueue.next(packet))
@@ -168,10 +175,30 @@ void WorldSession::SendPacket(WorldPacket const* packet)
 
 #endif                                                  // !MANGOS_DEBUG
 
+    if (sWorld.IsSendBatching())
+    {
+        m_sendBuffer << uint16(packet->GetOpcode());
+        m_sendBuffer << uint32(packet->size());
+        if (!packet->empty())
+            m_sendBuffer.append(packet->contents(), packet->size());
+        return;
+    }
+
     if (m_Socket->SendPacket(*packet) == -1)
         m_Socket->CloseSocket();
 }
 
+void WorldSession::FlushPackets()
+{
+    if (m_sendBuffer.empty())
+        return;
+
+    if (m_Socket && !m_Socket->IsClosed() && m_Socket->SendPackets(m_sendBuffer) == -1)
+        m_Socket->CloseSocket();
+
+    m_sendBuffer.clear();
+}
+
 /// Add an incoming packet to the queue
 void WorldSession::QueuePacket(WorldPacket* new_packet)
 {
@@ -298,6 +325,9 @@ bool WorldSession::Update(PacketFilter& updater)
         delete packet;
     }
 
+    ///- Relay the position updates coalesced while processing the packets
+    FlushMovementRelay();
+
     ///- Cleanup socket pointer if need
     if (m_Socket && m_Socket->IsClosed())
     {
@@ -480,6 +510,9 @@ void WorldSession::LogoutPlayer(bool Save)
 
         SetPlayer(NULL);                                    // deleted in Remove/DeleteFromWorld call
 
+        // level, zone and equipment shown at the character screen may have changed
+        InvalidateCharEnum();
+
         ///- Send the 'logout complete' packet to the client
         WorldPacket data(SMSG_LOGOUT_COMPLETE, 0);
         SendPacket(&data);
@@ -242,6 +242,10 @@ class MANGOS_DLL_SPEC WorldSession
         void SendAddonsInfo();
 
         void SendPacket(WorldPacket const* packet);
+        /// Movement relay counters since the last call
+        static void GetMovementRelayStats(uint32& relayed, uint32& coalesced, uint32& farSkipped);
+        /// Hand the packets staged while World::IsSendBatching() to the socket in one batch
+        void FlushPackets();
         void SendNotification(const char* format, ...) ATTR_PRINTF(2, 3);
         void SendNotification(int32 string_id, ...);
         void SendPetNameInvalid(uint32 error, const std::string& name, DeclinedName* declinedName);
@@ -286,6 +290,11 @@ class MANGOS_DLL_SPEC WorldSession
         void LogoutPlayer(bool Save);
         void KickPlayer();
 
+        // character list of the account, kept until one of its characters changes
+        void LoadCharEnum();
+        void InvalidateCharEnum();
+        bool IsCharEnumListing(uint32 lowguid) const;
+
         void QueuePacket(WorldPacket* new_packet);
 
         bool Update(PacketFilter& updater);
@@ -416,7 +425,7 @@ class MANGOS_DLL_SPEC WorldSession
         void HandleCharDeleteOpcode(WorldPacket& recvPacket);
         void HandleCharCreateOpcode(WorldPacket& recvPacket);
         void HandlePlayerLoginOpcode(WorldPacket& recvPacket);
-        void HandleCharEnum(QueryResult* result);
+        void HandleCharEnum(QueryResult* result, uint32 queryId);
         void HandlePlayerLogin(LoginQueryHolder* holder);
 
         // played time
@@ -881,6 +890,10 @@ class MANGOS_DLL_SPEC WorldSession
         bool VerifyMovementInfo(MovementInfo const& movementInfo, ObjectGuid const& guid) const;
         void HandleMoverRelocation(MovementInfo& movementInfo);
 
+        // movement relay to observers, position updates are coalesced per tick
+        void RelayMovement(Unit* mover, WorldPacket& data);
+        void FlushMovementRelay();
+
         void ExecuteOpcode(OpcodeHandler const& opHandle, WorldPacket* packet);
 
         // logging helper
@@ -891,6 +904,16 @@ class MANGOS_DLL_SPEC WorldSession
         Player* _player;
         WorldSocket* m_Socket;
         std::string m_Address;
+        ByteBuffer m_sendBuffer;                            // staged outgoing packets: uint16 opcode, uint32 size, payload
+        WorldPacket* m_movementRelay;                       // latest position update of the mover not relayed yet (MSG_NULL_ACTION if none), reused
+        ObjectGuid m_movementRelayMover;
+        uint32 m_movementRelayFarTime;                      // last time far observers got a position update
+        WorldPacket* m_charEnum;                            // SMSG_CHAR_ENUM of the account, NULL until loaded or after a listed character changed
+        std::vector<uint32> m_charEnumGuids;                // characters listed in m_charEnum
+        uint32 m_charEnumQuery;                             // id of the latest character list query, results of older ones are dropped
+        bool m_charEnumLoading;
+        bool m_charEnumStale;                               // a character changed while the latest query was running
+        bool m_charEnumRequested;                           // client waits for the character list
 
         AccountTypes _security;
         uint32 _accountId;
@@ -23,6 +23,8 @@
 #include <ace/os_include/netinet/os_tcp.h>
 #include <ace/os_include/sys/os_types.h>
 #include <ace/os_include/sys/os_socket.h>
+#include <ace/os_include/sys/os_uio.h>
+#include <ace/OS_NS_sys_socket.h>
 #include <ace/OS_NS_string.h>
 #include <ace/Reactor.h>
 #include <ace/Auto_Ptr.h>
@@ -42,6 +44,7 @@
 #include "WorldSocketMgr.h"
 #include "Log.h"
 #include "DBCStores.h"
+#include "Unit.h"
 
 #if defined( __GNUC__ )
 #pragma pack(1)
@@ -96,6 +99,12 @@ struct ClientPktHeader
 #pragma pack(pop)
 #endif
 
+/// Received packets of these opcodes are allocated as MovementPacket and decoded by the network thread
+static bool IsMovementOpcode(uint32 opcode)
+{
+    return opcode < NUM_MSG_TYPES && opcodeTable[opcode].handler == &WorldSession::HandleMovementOpcodes;
+}
+
 WorldSocket::WorldSocket(void) :
     WorldHandler(),
     m_LastPingTime(ACE_Time_Value::zero),
@@ -107,6 +116,7 @@ WorldSocket::WorldSocket(void) :
     m_OutBuffer(0),
     m_OutBufferSize(65536),
     m_OutActive(false),
+    m_OutCork(false),
     m_Seed(static_cast<uint32>(rand32()))
 {
     reference_counting_policy().value(ACE_Event_Handler::Reference_Counting_Policy::ENABLED);
@@ -166,17 +176,63 @@ int WorldSocket::SendPacket(const WorldPacket& pct)
     // Dump outgoing packet.
     sLog.outWorldPacketDump(uint32(get_handle()), pct.GetOpcode(), pct.GetOpcodeName(), &pct, false);
 
-    ServerPktHeader header(pct.size() + 2, pct.GetOpcode());
-    m_Crypt.EncryptSend((uint8*)header.header, header.getHeaderLength());
+    return queue_packet(pct.GetOpcode(), pct.empty() ? NULL : pct.contents(), pct.size());
+}
+
+int WorldSocket::SendPackets(const ByteBuffer& staged)
+{
+    ACE_GUARD_RETURN(LockType, Guard, m_OutBufferLock, -1);
+
+    if (closing_)
+        return -1;
 
-    if (m_OutBuffer->space() >= pct.size() + header.getHeaderLength() && msg_queue()->is_empty())
+    size_t pos = 0;
+
+    while (pos < staged.size())
     {
+        const uint16 opcode = staged.read<uint16>(pos);
+        const uint32 size = staged.read<uint32>(pos + sizeof(uint16));
+        pos += sizeof(uint16) + sizeof(uint32);
+
+        const uint8* data = size ? staged.contents() + pos : NULL;
+        pos += size;
+
+        // Dump outgoing packet.
+        if (sLog.IsOutWorldPacketDump())
+        {
+            WorldPacket pct(Opcodes(opcode), size);
+            if (size)
+                pct.append(data, size);
+
+            sLog.outWorldPacketDump(uint32(get_handle()), opcode, pct.GetOpcodeName(), &pct, false);
+        }
+
+        if (queue_packet(opcode, data, size) == -1)
+            return -1;
+    }
+
+    return 0;
+}
+
+int WorldSocket::queue_packet(uint16 opcode, const uint8* data, size_t size)
+{
+    ServerPktHeader header(size + 2, opcode);
+
+    // the header is encrypted by the network thread when the output is flushed
+    PendingHeader pending;
+    pending.length = header.getHeaderLength();
+
+    if (m_OutBuffer->space() >= size + header.getHeaderLength() && msg_queue()->is_empty())
+    {
+        pending.block = m_OutBuffer;
+        pending.offset = m_OutBuffer->wr_ptr() - m_OutBuffer->base();
+
         // Put the packet on the buffer.
         if (m_OutBuffer->copy((char*) header.header, header.getHeaderLength()) == -1)
             MANGOS_ASSERT(false);
 
-        if (!pct.empty())
-            if (m_OutBuffer->copy((char*) pct.contents(), pct.size()) == -1)
+        if (size)
+            if (m_OutBuffer->copy((const char*) data, size) == -1)
                 MANGOS_ASSERT(false);
     }
     else
@@ -184,12 +240,15 @@ int WorldSocket::SendPacket(const WorldPacket& pct)
         // Enqueue the packet.
         ACE_Message_Block* mb;
 
-        ACE_NEW_RETURN(mb, ACE_Message_Block(pct.size() + header.getHeaderLength()), -1);
+        ACE_NEW_RETURN(mb, ACE_Message_Block(size + header.getHeaderLength()), -1);
+
+        pending.block = mb;
+        pending.offset = 0;
 
         mb->copy((char*) header.header, header.getHeaderLength());
 
-        if (!pct.empty())
-            mb->copy((const char*)pct.contents(), pct.size());
+        if (size)
+            mb->copy((const char*) data, size);
 
         if (msg_queue()->enqueue_tail(mb, (ACE_Time_Value*)&ACE_Time_Value::zero) == -1)
         {
@@ -199,9 +258,44 @@ int WorldSocket::SendPacket(const WorldPacket& pct)
         }
     }
 
+    if (m_Crypt.IsInitialized())
+        m_PendingHeaders.push_back(pending);
+
     return 0;
 }
 
+void WorldSocket::encrypt_pending_headers()
+{
+    if (m_PendingHeaders.empty())
+        return;
+
+    // RC4 is a stream cipher over the header bytes only, so the headers of
+    // the flush are stitched together in stream order and encrypted in one pass
+    size_t total = 0;
+    for (PendingHeaderList::const_iterator itr = m_PendingHeaders.begin(); itr != m_PendingHeaders.end(); ++itr)
+        total += itr->length;
+
+    m_HeaderScratch.resize(total);
+
+    uint8* scratch = &m_HeaderScratch[0];
+    for (PendingHeaderList::const_iterator itr = m_PendingHeaders.begin(); itr != m_PendingHeaders.end(); ++itr)
+    {
+        memcpy(scratch, itr->block->base() + itr->offset, itr->length);
+        scratch += itr->length;
+    }
+
+    m_Crypt.EncryptSend(&m_HeaderScratch[0], total);
+
+    scratch = &m_HeaderScratch[0];
+    for (PendingHeaderList::const_iterator itr = m_PendingHeaders.begin(); itr != m_PendingHeaders.end(); ++itr)
+    {
+        memcpy(itr->block->base() + itr->offset, scratch, itr->length);
+        scratch += itr->length;
+    }
+
+    m_PendingHeaders.clear();
+}
+
 long WorldSocket::AddReference(void)
 {
     return static_cast<long>(add_reference());
@@ -325,104 +419,160 @@ int WorldSocket::handle_output(ACE_HANDLE)
     if (closing_)
         return -1;
 
-    const size_t send_len = m_OutBuffer->length();
+    encrypt_pending_headers();
 
-    if (send_len == 0)
-        return handle_output_queue(Guard);
-
-#ifdef MSG_NOSIGNAL
-    ssize_t n = peer().send(m_OutBuffer->rd_ptr(), send_len, MSG_NOSIGNAL);
-#else
-    ssize_t n = peer().send(m_OutBuffer->rd_ptr(), send_len);
-#endif // MSG_NOSIGNAL
+    if (m_OutBuffer->length() == 0 && msg_queue()->is_empty())
+        return cancel_wakeup_output(Guard);
 
-    if (n == 0)
-        return -1;
-    else if (n == -1)
-    {
-        if (errno == EWOULDBLOCK || errno == EAGAIN)
-            return schedule_wakeup_output(Guard);
+    size_t syscalls = 0;
+    size_t bytes = 0;
 
-        return -1;
-    }
-    else if (n < (ssize_t)send_len) // now n > 0
-    {
-        m_OutBuffer->rd_ptr(static_cast<size_t>(n));
+    set_output_cork(true);
+    const int result = handle_output_queue(syscalls, bytes);
+    set_output_cork(false);
 
-        // move the data to the base of the buffer
-        m_OutBuffer->crunch();
+    sWorldSocketMgr->RecordOutputFlush(syscalls, bytes);
 
+    if (result == -1)
+        return -1;
+    else if (result == 0)
         return schedule_wakeup_output(Guard);
-    }
-    else // now n == send_len
-    {
-        m_OutBuffer->reset();
-
-        return handle_output_queue(Guard);
-    }
 
-    ACE_NOTREACHED(return 0);
+    return cancel_wakeup_output(Guard);
 }
 
-int WorldSocket::handle_output_queue(GuardType& g)
+int WorldSocket::handle_output_queue(size_t& syscalls, size_t& bytes)
 {
-    if (msg_queue()->is_empty())
-        return cancel_wakeup_output(g);
+    iovec iov[OUTPUT_IOV_MAX];
 
-    ACE_Message_Block* mblk;
-
-    if (msg_queue()->dequeue_head(mblk, (ACE_Time_Value*)&ACE_Time_Value::zero) == -1)
+    for (;;)
     {
-        sLog.outError("WorldSocket::handle_output_queue dequeue_head");
-        return -1;
-    }
+        // gather the output buffer followed by the queued blocks, in send order
+        int iovcnt = 0;
+        size_t send_len = 0;
 
-    const size_t send_len = mblk->length();
+        if (m_OutBuffer->length() > 0)
+        {
+            iov[iovcnt].iov_base = m_OutBuffer->rd_ptr();
+            iov[iovcnt].iov_len = m_OutBuffer->length();
+            send_len += m_OutBuffer->length();
+            ++iovcnt;
+        }
+
+        ACE_Message_Block* mblk = NULL;
+
+        if (!msg_queue()->is_empty() && msg_queue()->peek_dequeue_head(mblk, (ACE_Time_Value*) &ACE_Time_Value::zero) == -1)
+        {
+            sLog.outError("WorldSocket::handle_output_queue peek_dequeue_head");
+            return -1;
+        }
+
+        for (; mblk && iovcnt < OUTPUT_IOV_MAX; mblk = mblk->next())
+        {
+            iov[iovcnt].iov_base = mblk->rd_ptr();
+            iov[iovcnt].iov_len = mblk->length();
+            send_len += mblk->length();
+            ++iovcnt;
+        }
+
+        if (iovcnt == 0)
+            return 1;
 
 #ifdef MSG_NOSIGNAL
-    ssize_t n = peer().send(mblk->rd_ptr(), send_len, MSG_NOSIGNAL);
+        msghdr msg;
+        ACE_OS::memset(&msg, 0, sizeof(msg));
+        msg.msg_iov = iov;
+        msg.msg_iovlen = iovcnt;
+
+        ssize_t n = ACE_OS::sendmsg(get_handle(), &msg, MSG_NOSIGNAL);
 #else
-    ssize_t n = peer().send(mblk->rd_ptr(), send_len);
+        ssize_t n = peer().sendv(iov, iovcnt);
 #endif // MSG_NOSIGNAL
 
-    if (n == 0)
+        ++syscalls;
+
+        if (n == 0)
+            return -1;
+        else if (n == -1)
+        {
+            if (errno == EWOULDBLOCK || errno == EAGAIN)
+                return 0;
+
+            return -1;
+        }
+
+        bytes += static_cast<size_t>(n);
+
+        if (consume_output(static_cast<size_t>(n)) == -1)
+            return -1;
+
+        // kernel buffer is full, wait for the reactor to tell us when we can write again
+        if (n < (ssize_t)send_len)
+            return 0;
+    }
+
+    ACE_NOTREACHED(return -1);
+}
+
+int WorldSocket::consume_output(size_t len)
+{
+    if (m_OutBuffer->length() > 0)
     {
-        mblk->release();
+        const size_t part = std::min(len, m_OutBuffer->length());
 
-        return -1;
+        m_OutBuffer->rd_ptr(part);
+        len -= part;
+
+        if (m_OutBuffer->length() == 0)
+            m_OutBuffer->reset();
+        else
+            // move the data to the base of the buffer
+            m_OutBuffer->crunch();
     }
-    else if (n == -1)
+
+    while (len > 0)
     {
-        if (errno == EWOULDBLOCK || errno == EAGAIN)
+        ACE_Message_Block* mblk;
+
+        if (msg_queue()->peek_dequeue_head(mblk, (ACE_Time_Value*) &ACE_Time_Value::zero) == -1)
         {
-            msg_queue()->enqueue_head(mblk, (ACE_Time_Value*) &ACE_Time_Value::zero);
-            return schedule_wakeup_output(g);
+            sLog.outError("WorldSocket::consume_output peek_dequeue_head");
+            return -1;
         }
 
-        mblk->release();
-        return -1;
-    }
-    else if (n < (ssize_t)send_len) // now n > 0
-    {
-        mblk->rd_ptr(static_cast<size_t>(n));
+        const size_t part = std::min(len, mblk->length());
 
-        if (msg_queue()->enqueue_head(mblk, (ACE_Time_Value*) &ACE_Time_Value::zero) == -1)
+        mblk->rd_ptr(part);
+        len -= part;
+
+        if (mblk->length() > 0)
+            break;
+
+        if (msg_queue()->dequeue_head(mblk, (ACE_Time_Value*) &ACE_Time_Value::zero) == -1)
         {
-            sLog.outError("WorldSocket::handle_output_queue enqueue_head");
-            mblk->release();
+            sLog.outError("WorldSocket::consume_output dequeue_head");
             return -1;
         }
 
-        return schedule_wakeup_output(g);
-    }
-    else // now n == send_len
-    {
         mblk->release();
-
-        return msg_queue()->is_empty() ? cancel_wakeup_output(g) : ACE_Event_Handler::WRITE_MASK;
     }
 
-    ACE_NOTREACHED(return -1);
+    return 0;
+}
+
+void WorldSocket::set_output_cork(bool on)
+{
+#if defined(TCP_CORK)
+    if (!m_OutCork)
+        return;
+
+    const int option = on ? 1 : 0;
+
+    if (peer().set_option(ACE_IPPROTO_TCP, TCP_CORK, (void*)&option, sizeof(int)) == -1)
+        DEBUG_LOG("WorldSocket::set_output_cork: peer().set_option TCP_CORK errno = %s", ACE_OS::strerror(errno));
+#else
+    (void)on;
+#endif // TCP_CORK
 }
 
 int WorldSocket::handle_close(ACE_HANDLE h, ACE_Reactor_Mask)
@@ -488,7 +638,11 @@ int WorldSocket::handle_input_header(void)
 
     header.size -= 4;
 
-    ACE_NEW_RETURN(m_RecvWPct, WorldPacket(Opcodes(header.cmd), header.size), -1);
+    // movement is decoded on this thread later, in ProcessIncoming()
+    if (IsMovementOpcode(header.cmd))
+        ACE_NEW_RETURN(m_RecvWPct, MovementPacket(Opcodes(header.cmd), header.size), -1);
+    else
+        ACE_NEW_RETURN(m_RecvWPct, WorldPacket(Opcodes(header.cmd), header.size), -1);
 
     if (header.size > 0)
     {
@@ -695,6 +849,12 @@ int WorldSocket::ProcessIncoming(WorldPacket* new_pct)
                 return 0;
             default:
             {
+                if (IsMovementOpcode(opcode) && !static_cast<MovementPacket*>(new_pct)->Decode())
+                {
+                    DEBUG_LOG("WorldSocket::ProcessIncoming: dropped movement opcode %u with invalid position from %s", uint32(opcode), GetRemoteAddress().c_str());
+                    return 0;
+                }
+
                 ACE_GUARD_RETURN(LockType, Guard, m_SessionLock, -1);
 
                 if (m_Session != NULL)
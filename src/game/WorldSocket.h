@@ -35,6 +35,7 @@
 #include <ace/Guard_T.h>
 #include <ace/Unbounded_Queue.h>
 #include <ace/Message_Block.h>
+#include <ace/os_include/os_limits.h>
 
 #if !defined (ACE_LACKS_PRAGMA_ONCE)
 #pragma once
@@ -45,6 +46,7 @@
 #include "Auth/BigNumber.h"
 
 class ACE_Message_Block;
+class ByteBuffer;
 class WorldPacket;
 class WorldSession;
 
@@ -72,6 +74,10 @@ typedef ACE_Svc_Handler<ACE_SOCK_STREAM, ACE_NULL_SYNCH> WorldHandler;
  * sending packets from "producer" threads is minimal,
  * and doing a lot of writes with small size is tolerated.
  *
+ * On flush the buffer and the queued packets are gathered
+ * into vectored sends, so a burst of packets costs one
+ * syscall per batch rather than one per packet.
+ *
  * The calls to Update () method are managed by WorldSocketMgr
  * and ReactorRunnable.
  *
@@ -116,6 +122,11 @@ class WorldSocket : protected WorldHandler
         /// @return -1 of failure
         int SendPacket(const WorldPacket& pct);
 
+        /// Send packets staged by WorldSession during a tick, taking the output lock once.
+        /// @param staged sequence of (uint16 opcode, uint32 size, payload) records
+        /// @return -1 of failure
+        int SendPackets(const ByteBuffer& staged);
+
         /// Add reference to this object.
         long AddReference(void);
 
@@ -155,13 +166,30 @@ class WorldSocket : protected WorldHandler
         int handle_input_payload(void);
         int handle_input_missing_data(void);
 
+        /// Put one packet with a plain header on the output buffer or queue,
+        /// the header is encrypted later by encrypt_pending_headers() at flush.
+        /// Must be called with m_OutBufferLock held.
+        int queue_packet(uint16 opcode, const uint8* data, size_t size);
+
+        /// Encrypt the headers queued since the last flush, in stream order.
+        /// Must be called with m_OutBufferLock held.
+        void encrypt_pending_headers();
+
         /// Help functions to mark/unmark the socket for output.
         /// @param g the guard is for m_OutBufferLock, the function will release it
         int cancel_wakeup_output(GuardType& g);
         int schedule_wakeup_output(GuardType& g);
 
-        /// Drain the queue if its not empty.
-        int handle_output_queue(GuardType& g);
+        /// Gather the output buffer and the queued blocks into vectored sends
+        /// until everything is written or the kernel buffer fills up.
+        /// @return 1 when drained, 0 when the socket would block, -1 on failure
+        int handle_output_queue(size_t& syscalls, size_t& bytes);
+
+        /// Drop len sent bytes from the head of the output buffer and queue.
+        int consume_output(size_t len);
+
+        /// Toggle TCP_CORK around a flush if Network.CorkOnFlush is enabled.
+        void set_output_cork(bool on);
 
         /// process one incoming packet.
         /// @param new_pct received packet ,note that you need to delete it.
@@ -215,6 +243,27 @@ class WorldSocket : protected WorldHandler
         /// True if the socket is registered with the reactor for output
         bool m_OutActive;
 
+        /// Location of a queued server header that still has to be encrypted.
+        struct PendingHeader
+        {
+            ACE_Message_Block* block;
+            size_t offset;
+            size_t length;
+        };
+        typedef std::vector<PendingHeader> PendingHeaderList;
+
+        /// Headers queued since the last flush, in stream order.
+        PendingHeaderList m_PendingHeaders;
+
+        /// Reused buffer the pending headers are stitched into for encryption.
+        std::vector<uint8> m_HeaderScratch;
+
+        /// True if each output flush is wrapped in TCP_CORK.
+        bool m_OutCork;
+
+        /// Max number of blocks gathered into one send call.
+        enum { OUTPUT_IOV_MAX = ACE_IOV_MAX < 64 ? ACE_IOV_MAX : 64 };
+
         uint32 m_Seed;
 
         BigNumber m_s;
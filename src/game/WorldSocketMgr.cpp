@@ -209,6 +209,10 @@ WorldSocketMgr::WorldSocketMgr():
     m_SockOutKBuff(-1),
     m_SockOutUBuff(65536),
     m_UseNoDelay(true),
+    m_UseCork(false),
+    m_OutputFlushes(0),
+    m_OutputSyscalls(0),
+    m_OutputBytes(0),
     m_Acceptor(0)
 {
 }
@@ -222,6 +226,7 @@ WorldSocketMgr::~WorldSocketMgr()
 int WorldSocketMgr::StartReactiveIO(ACE_UINT16 port, const char* address)
 {
     m_UseNoDelay = sConfig.GetBoolDefault("Network.TcpNodelay", true);
+    m_UseCork = sConfig.GetBoolDefault("Network.CorkOnFlush", false);
 
     int num_threads = sConfig.GetIntDefault("Network.Threads", 1);
 
@@ -296,6 +301,13 @@ void WorldSocketMgr::StopNetwork()
     }
 
     Wait();
+
+    WorldSocketOutputStats stats = GetOutputStats();
+
+    if (stats.flushes)
+        sLog.outString("Network output: " UI64FMTD " flushes, " UI64FMTD " send calls, " UI64FMTD " bytes (%.2f calls and %.0f bytes per flush)",
+                       stats.flushes, stats.syscalls, stats.bytes,
+                       double(stats.syscalls) / double(stats.flushes), double(stats.bytes) / double(stats.flushes));
 }
 
 void WorldSocketMgr::Wait()
@@ -332,6 +344,7 @@ int WorldSocketMgr::OnSocketOpen(WorldSocket* sock)
     }
 
     sock->m_OutBufferSize = static_cast<size_t>(m_SockOutUBuff);
+    sock->m_OutCork = m_UseCork;
 
     // we skip the Acceptor Thread
     size_t min = 1;
@@ -345,6 +358,22 @@ int WorldSocketMgr::OnSocketOpen(WorldSocket* sock)
     return m_NetThreads[min].AddSocket(sock);
 }
 
+void WorldSocketMgr::RecordOutputFlush(size_t syscalls, size_t bytes)
+{
+    ++m_OutputFlushes;
+    m_OutputSyscalls += syscalls;
+    m_OutputBytes += bytes;
+}
+
+WorldSocketOutputStats WorldSocketMgr::GetOutputStats()
+{
+    WorldSocketOutputStats stats;
+    stats.flushes = m_OutputFlushes.value();
+    stats.syscalls = m_OutputSyscalls.value();
+    stats.bytes = m_OutputBytes.value();
+    return stats;
+}
+
 WorldSocketMgr* WorldSocketMgr::Instance()
 {
     return ACE_Singleton<WorldSocketMgr, ACE_Thread_Mutex>::instance();
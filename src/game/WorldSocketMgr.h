@@ -28,6 +28,7 @@
 #include <ace/Basic_Types.h>
 #include <ace/Singleton.h>
 #include <ace/Thread_Mutex.h>
+#include <ace/Atomic_Op.h>
 
 #include <string>
 
@@ -35,6 +36,16 @@ class WorldSocket;
 class ReactorRunnable;
 class ACE_Event_Handler;
 
+/// Totals of the socket output flushes, used to check how well writes are batched
+struct WorldSocketOutputStats
+{
+    WorldSocketOutputStats() : flushes(0), syscalls(0), bytes(0) {}
+
+    ACE_UINT64 flushes;
+    ACE_UINT64 syscalls;
+    ACE_UINT64 bytes;
+};
+
 /// Manages all sockets connected to peers and network threads
 class WorldSocketMgr
 {
@@ -54,6 +65,12 @@ class WorldSocketMgr
         std::string& GetBindAddress() { return m_addr; }
         ACE_UINT16 GetBindPort() { return m_port; }
 
+        /// Account one output flush of a socket.
+        void RecordOutputFlush(size_t syscalls, size_t bytes);
+
+        /// Snapshot of the output flush counters.
+        WorldSocketOutputStats GetOutputStats();
+
         /// Make this class singleton .
         static WorldSocketMgr* Instance();
 
@@ -70,6 +87,12 @@ class WorldSocketMgr
         int m_SockOutKBuff;
         int m_SockOutUBuff;
         bool m_UseNoDelay;
+        bool m_UseCork;
+
+        /// Output flush counters, updated by all network threads
+        ACE_Atomic_Op<ACE_Thread_Mutex, ACE_UINT64> m_OutputFlushes;
+        ACE_Atomic_Op<ACE_Thread_Mutex, ACE_UINT64> m_OutputSyscalls;
+        ACE_Atomic_Op<ACE_Thread_Mutex, ACE_UINT64> m_OutputBytes;
 
         std::string m_addr;
         ACE_UINT16 m_port;
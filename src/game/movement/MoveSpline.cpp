@@ -37,7 +37,17 @@ namespace Movement
             u = (time_passed - spline.length(point_Idx)) / (float)seg_time;
         Location c;
         c.orientation = initialOrientation;
-        spline.evaluate_percent(point_Idx, u, c);
+
+        // the tangent is only needed for orientation, evaluate it in the same pass as the position
+        bool finalFacing = splineflags.done && splineflags.isFacing();
+        Vector3 hermite;
+        if (!finalFacing && !splineflags.hasFlag(MoveSplineFlag::OrientationFixed | MoveSplineFlag::Falling))
+        {
+            spline.evaluate_percent_and_derivative(point_Idx, u, c, hermite);
+            c.orientation = atan2(hermite.y, hermite.x);
+        }
+        else
+            spline.evaluate_percent(point_Idx, u, c);
 
         if (splineflags.animation)
             ;// MoveSplineFlag::Animation disables falling or parabolic movement
@@ -46,7 +56,7 @@ namespace Movement
         else if (splineflags.falling)
             computeFallElevation(c.z);
 
-        if (splineflags.done && splineflags.isFacing())
+        if (finalFacing)
         {
             if (splineflags.final_angle)
                 c.orientation = facing.angle;
@@ -54,18 +64,8 @@ namespace Movement
                 c.orientation = atan2(facing.f.y - c.y, facing.f.x - c.x);
             // nothing to do for MoveSplineFlag::Final_Target flag
         }
-        else
-        {
-            if (!splineflags.hasFlag(MoveSplineFlag::OrientationFixed | MoveSplineFlag::Falling))
-            {
-                Vector3 hermite;
-                spline.evaluate_derivative(point_Idx, u, hermite);
-                c.orientation = atan2(hermite.y, hermite.x);
-            }
-
-            if (splineflags.orientationInversed)
-                c.orientation = -c.orientation;
-        }
+        else if (splineflags.orientationInversed)
+            c.orientation = -c.orientation;
         return c;
     }
 
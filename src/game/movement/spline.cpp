@@ -38,6 +38,14 @@ namespace Movement
         (EvaluationMethtod)& SplineBase::UninitializedSpline,
     };
 
+    SplineBase::EvaluationWithDerivativeMethtod SplineBase::evaluators_with_derivative[SplineBase::ModesEnd] =
+    {
+        &SplineBase::EvaluateWithDerivativeLinear,
+        &SplineBase::EvaluateWithDerivativeCatmullRom,
+        &SplineBase::EvaluateWithDerivativeBezier3,
+        (EvaluationWithDerivativeMethtod)& SplineBase::UninitializedSpline,
+    };
+
     SplineBase::SegLenghtMethtod SplineBase::seglengths[SplineBase::ModesEnd] =
     {
         &SplineBase::SegLengthLinear,
@@ -113,6 +121,18 @@ namespace Movement
                  + vertice[2] * weights[2] + vertice[3] * weights[3];
     }
 
+    inline void C_Evaluate_With_Derivative(const Vector3* vertice, float t, const Matrix4& matr, Vector3& position, Vector3& derivative)
+    {
+        float t2 = t * t;
+        Vector4 weights(Vector4(t2 * t, t2, t, 1.f) * matr);
+        Vector4 d_weights(Vector4(3.f * t2, 2.f * t, 1.f, 0.f) * matr);
+
+        position = vertice[0] * weights[0] + vertice[1] * weights[1]
+                   + vertice[2] * weights[2] + vertice[3] * weights[3];
+        derivative = vertice[0] * d_weights[0] + vertice[1] * d_weights[1]
+                     + vertice[2] * d_weights[2] + vertice[3] * d_weights[3];
+    }
+
     void SplineBase::EvaluateLinear(index_type index, float u, Vector3& result) const
     {
         MANGOS_ASSERT(index >= index_lo && index < index_hi);
@@ -151,6 +171,26 @@ namespace Movement
         C_Evaluate_Derivative(&points[index], t, s_Bezier3Coeffs, result);
     }
 
+    void SplineBase::EvaluateWithDerivativeLinear(index_type index, float u, Vector3& position, Vector3& derivative) const
+    {
+        MANGOS_ASSERT(index >= index_lo && index < index_hi);
+        derivative = points[index + 1] - points[index];
+        position = points[index] + derivative * u;
+    }
+
+    void SplineBase::EvaluateWithDerivativeCatmullRom(index_type index, float t, Vector3& position, Vector3& derivative) const
+    {
+        MANGOS_ASSERT(index >= index_lo && index < index_hi);
+        C_Evaluate_With_Derivative(&points[index - 1], t, s_catmullRomCoeffs, position, derivative);
+    }
+
+    void SplineBase::EvaluateWithDerivativeBezier3(index_type index, float t, Vector3& position, Vector3& derivative) const
+    {
+        index *= 3u;
+        MANGOS_ASSERT(index >= index_lo && index < index_hi);
+        C_Evaluate_With_Derivative(&points[index], t, s_Bezier3Coeffs, position, derivative);
+    }
+
     float SplineBase::SegLengthLinear(index_type index) const
     {
         MANGOS_ASSERT(index >= index_lo && index < index_hi);
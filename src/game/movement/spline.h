@@ -70,6 +70,12 @@ namespace Movement
             void EvaluateDerivativeBezier3(index_type, float, Vector3&) const;
             static EvaluationMethtod derivative_evaluators[ModesEnd];
 
+            void EvaluateWithDerivativeLinear(index_type, float, Vector3&, Vector3&) const;
+            void EvaluateWithDerivativeCatmullRom(index_type, float, Vector3&, Vector3&) const;
+            void EvaluateWithDerivativeBezier3(index_type, float, Vector3&, Vector3&) const;
+            typedef void (SplineBase::*EvaluationWithDerivativeMethtod)(index_type, float, Vector3&, Vector3&) const;
+            static EvaluationWithDerivativeMethtod evaluators_with_derivative[ModesEnd];
+
             float SegLengthLinear(index_type) const;
             float SegLengthCatmullRom(index_type) const;
             float SegLengthBezier3(index_type) const;
@@ -100,6 +106,12 @@ namespace Movement
              */
             void evaluate_derivative(index_type Idx, float u, Vector3& hermite) const {(this->*derivative_evaluators[m_mode])(Idx, u, hermite);}
 
+            /** Caclulates position and derivation in index Idx at once, sharing the control points and weights
+                @param Idx - spline segment index, should be in range [first, last)
+                @param t  - percent of spline segment length, assumes that t in range [0, 1]
+             */
+            void evaluate_percent_and_derivative(index_type Idx, float u, Vector3& c, Vector3& hermite) const {(this->*evaluators_with_derivative[m_mode])(Idx, u, c, hermite);}
+
             /**  Bounds for spline indexes. All indexes should be in range [first, last). */
             index_type first() const { return index_lo;}
             index_type last()  const { return index_hi;}
@@ -28,6 +28,7 @@
 #include "AuthSocket.h"
 #include "AuthCodes.h"
 #include "PatchHandler.h"
+#include "AuthWorkerPool.h"
 
 #include <openssl/md5.h>
 //#include "Util.h" -- for commented utf8ToUpperOnlyLatin
@@ -188,7 +189,12 @@ AuthSocket::AuthSocket()
     _accountSecurityLevel = SEC_PLAYER;
 
     _build = 0;
+    _accountId = 0;
     patch_ = ACE_INVALID_HANDLE;
+
+    _deferredWork = NULL;
+    _deferredFinish = NULL;
+    _deferredClose = false;
 }
 
 /// Close patch file descriptor before leaving
@@ -210,6 +216,10 @@ void AuthSocket::OnRead()
     uint8 _cmd;
     while (1)
     {
+        // next command is handled when the worker finished the current one
+        if (_deferredWork)
+            return;
+
         if (!recv_soft((char*)&_cmd, 1))
             return;
 
@@ -245,6 +255,84 @@ void AuthSocket::OnRead()
     }
 }
 
+/// Hand the blocking part of the current request to the worker pool, or run it in place without pool
+bool AuthSocket::Defer(DeferredStep work, DeferredStep finish /*= NULL*/)
+{
+    _deferredReply.clear();
+    _deferredClose = false;
+
+    if (!AuthWorkerPool::instance()->IsActive())
+    {
+        (this->*work)();
+        return CompleteDeferred(finish);
+    }
+
+    _deferredWork = work;
+    _deferredFinish = finish;
+
+    // keep the socket alive until handle_exception, also if the client disconnects meanwhile
+    add_reference();
+
+    if (!AuthWorkerPool::instance()->Enqueue(this))
+    {
+        _deferredWork = NULL;
+        _deferredFinish = NULL;
+        remove_reference();
+        close_connection();
+        return false;
+    }
+
+    return true;
+}
+
+/// Executed in a worker thread, the reactor thread does not touch the socket state until notified
+void AuthSocket::RunDeferred()
+{
+    (this->*_deferredWork)();
+
+    if (reactor()->notify(this, ACE_Event_Handler::EXCEPT_MASK) == -1)
+    {
+        sLog.outError("AuthSocket::RunDeferred: unable to notify reactor for '%s', closing", get_remote_address().c_str());
+
+        // input stays paused, so let the reactor see EOF and drop the handler itself
+        peer().close_reader();
+        peer().close_writer();
+        remove_reference();
+    }
+}
+
+int AuthSocket::handle_exception(ACE_HANDLE)
+{
+    DeferredStep finish = _deferredFinish;
+    _deferredWork = NULL;
+    _deferredFinish = NULL;
+
+    // continue with the commands received meanwhile
+    if (!is_closed() && CompleteDeferred(finish))
+        resume_input();
+
+    remove_reference();
+    return 0;
+}
+
+/// Send the result of the deferred request, false if the connection was closed
+bool AuthSocket::CompleteDeferred(DeferredStep finish)
+{
+    if (finish)
+        (this->*finish)();
+
+    if (!_deferredReply.empty())
+        send((char const*)_deferredReply.contents(), _deferredReply.size());
+
+    if (_deferredClose)
+    {
+        close_connection();
+        return false;
+    }
+
+    return true;
+}
+
 /// Make the SRP6 calculation from hash in dB
 void AuthSocket::_SetVSFields(const std::string& rI)
 {
@@ -277,7 +365,7 @@ void AuthSocket::_SetVSFields(const std::string& rI)
     OPENSSL_free((void*)s_hex);
 }
 
-void AuthSocket::SendProof(Sha1Hash sha)
+void AuthSocket::BuildProof(ByteBuffer& pkt, Sha1Hash sha)
 {
     switch (_build)
     {
@@ -291,7 +379,7 @@ void AuthSocket::SendProof(Sha1Hash sha)
             proof.error = 0;
             proof.unk2 = 0x00;
 
-            send((char*)&proof, sizeof(proof));
+            pkt.append((uint8 const*)&proof, sizeof(proof));
             break;
         }
         case 8606:                                          // 2.4.3
@@ -310,7 +398,7 @@ void AuthSocket::SendProof(Sha1Hash sha)
             proof.surveyId = 0x00000000;
             proof.unkFlags = 0x0000;
 
-            send((char*)&proof, sizeof(proof));
+            pkt.append((uint8 const*)&proof, sizeof(proof));
             break;
         }
     }
@@ -356,8 +444,6 @@ bool AuthSocket::_HandleLogonChallenge()
     EndianConvert(ch->timezone_bias);
     EndianConvert(ch->ip);
 
-    ByteBuffer pkt;
-
     _login = (const char*)ch->I;
     _build = ch->build;
 
@@ -369,6 +455,18 @@ bool AuthSocket::_HandleLogonChallenge()
     _safelogin = _login;
     LoginDatabase.escape_string(_safelogin);
 
+    _deferredRequest.clear();
+    _deferredRequest.append(&buf[0], buf.size());
+
+    return Defer(&AuthSocket::_LogonChallengeWork);
+}
+
+/// Logon Challenge database lookups and SRP6 calculation
+void AuthSocket::_LogonChallengeWork()
+{
+    sAuthLogonChallenge_C const* ch = (sAuthLogonChallenge_C const*)_deferredRequest.contents();
+    ByteBuffer& pkt = _deferredReply;
+
     pkt << (uint8) CMD_AUTH_LOGON_CHALLENGE;
     pkt << (uint8) 0x00;
 
@@ -498,6 +596,8 @@ bool AuthSocket::_HandleLogonChallenge()
                         pkt << uint8(1);
                     }
 
+                    _accountId = (*result)[1].GetUInt32();
+
                     uint8 secLevel = (*result)[4].GetUInt8();
                     _accountSecurityLevel = secLevel <= SEC_ADMINISTRATOR ? AccountTypes(secLevel) : SEC_ADMINISTRATOR;
 
@@ -515,8 +615,6 @@ bool AuthSocket::_HandleLogonChallenge()
             pkt << (uint8) WOW_FAIL_UNKNOWN_ACCOUNT;
         }
     }
-    send((char const*)pkt.contents(), pkt.size());
-    return true;
 }
 
 /// Logon Proof command handler
@@ -591,15 +689,27 @@ bool AuthSocket::_HandleLogonProof()
     }
     /// </ul>
 
-    ///- Continue the SRP6 calculation based on data received from the client
+    // SRP safeguard: abort if A==0
     BigNumber A;
-
     A.SetBinary(lp.A, 32);
-
-    // SRP safeguard: abort if A==0
     if (A.isZero())
         return false;
 
+    _deferredRequest.clear();
+    _deferredRequest.append((uint8 const*)&lp, sizeof(lp));
+
+    return Defer(&AuthSocket::_LogonProofWork);
+}
+
+/// Logon Proof SRP6 verification and account update
+void AuthSocket::_LogonProofWork()
+{
+    sAuthLogonProof_C const& lp = *(sAuthLogonProof_C const*)_deferredRequest.contents();
+
+    ///- Continue the SRP6 calculation based on data received from the client
+    BigNumber A;
+    A.SetBinary(lp.A, 32);
+
     Sha1Hash sha;
     sha.UpdateBigNumbers(&A, &B, NULL);
     sha.Finalize();
@@ -681,7 +791,7 @@ bool AuthSocket::_HandleLogonProof()
         sha.UpdateBigNumbers(&A, &M, &K, NULL);
         sha.Finalize();
 
-        SendProof(sha);
+        BuildProof(_deferredReply, sha);
 
         ///- Set _authed to true!
         _authed = true;
@@ -690,14 +800,14 @@ bool AuthSocket::_HandleLogonProof()
     {
         if (_build > 6005)                                  // > 1.12.2
         {
-            char data[4] = { CMD_AUTH_LOGON_PROOF, WOW_FAIL_UNKNOWN_ACCOUNT, 3, 0};
-            send(data, sizeof(data));
+            uint8 data[4] = { CMD_AUTH_LOGON_PROOF, WOW_FAIL_UNKNOWN_ACCOUNT, 3, 0};
+            _deferredReply.append(data, sizeof(data));
         }
         else
         {
             // 1.x not react incorrectly at 4-byte message use 3 as real error
-            char data[2] = { CMD_AUTH_LOGON_PROOF, WOW_FAIL_UNKNOWN_ACCOUNT};
-            send(data, sizeof(data));
+            uint8 data[2] = { CMD_AUTH_LOGON_PROOF, WOW_FAIL_UNKNOWN_ACCOUNT};
+            _deferredReply.append(data, sizeof(data));
         }
         BASIC_LOG("[AuthChallenge] account %s tried to login with wrong password!", _login.c_str());
 
@@ -739,7 +849,6 @@ bool AuthSocket::_HandleLogonProof()
             }
         }
     }
-    return true;
 }
 
 /// Reconnect Challenge command handler
@@ -780,29 +889,34 @@ bool AuthSocket::_HandleReconnectChallenge()
     EndianConvert(ch->build);
     _build = ch->build;
 
-    QueryResult* result = LoginDatabase.PQuery("SELECT sessionkey FROM account WHERE username = '%s'", _safelogin.c_str());
+    return Defer(&AuthSocket::_ReconnectChallengeWork);
+}
+
+/// Reconnect Challenge session key lookup
+void AuthSocket::_ReconnectChallengeWork()
+{
+    QueryResult* result = LoginDatabase.PQuery("SELECT sessionkey, id FROM account WHERE username = '%s'", _safelogin.c_str());
 
     // Stop if the account is not found
     if (!result)
     {
         sLog.outError("[ERROR] user %s tried to login and we cannot find his session key in the database.", _login.c_str());
-        close_connection();
-        return false;
+        _deferredClose = true;
+        return;
     }
 
     Field* fields = result->Fetch();
     K.SetHexStr(fields[0].GetString());
+    _accountId = fields[1].GetUInt32();
     delete result;
 
     ///- Sending response
-    ByteBuffer pkt;
+    ByteBuffer& pkt = _deferredReply;
     pkt << (uint8)  CMD_AUTH_RECONNECT_CHALLENGE;
     pkt << (uint8)  0x00;
     _reconnectProof.SetRand(16 * 8);
     pkt.append(_reconnectProof.AsByteArray(16), 16);        // 16 bytes random
     pkt << (uint64) 0x00 << (uint64) 0x00;                  // 16 bytes zeros
-    send((char const*)pkt.contents(), pkt.size());
-    return true;
 }
 
 /// Reconnect Proof command handler
@@ -857,40 +971,76 @@ bool AuthSocket::_HandleRealmList()
 
     recv_skip(5);
 
-    ///- Get the user id (else close the connection)
-    // No SQL injection (escaped user name)
+    ///- Update realm list if need
+    sRealmList.UpdateIfNeed();
 
-    QueryResult* result = LoginDatabase.PQuery("SELECT id,sha_pass_hash FROM account WHERE username = '%s'", _safelogin.c_str());
-    if (!result)
+    ///- Character amounts of accounts that requested the list recently are cached, else the worker looks them up
+    if (sRealmList.GetCachedCharacters(_accountId, _realmCharacters))
     {
-        sLog.outError("[ERROR] user %s tried to login and we cannot find him in the database.", _login.c_str());
-        close_connection();
-        return false;
+        ByteBuffer pkt;
+        LoadRealmlist(pkt);
+        send((char const*)pkt.contents(), pkt.size());
+        return true;
     }
 
-    uint32 id = (*result)[0].GetUInt32();
-    std::string rI = (*result)[1].GetCppString();
-    delete result;
+    return Defer(&AuthSocket::_RealmListWork, &AuthSocket::_RealmListFinish);
+}
 
-    ///- Update realm list if need
-    sRealmList.UpdateIfNeed();
+/// %Realm List character amounts lookup, one query for all realms
+void AuthSocket::_RealmListWork()
+{
+    _realmCharacters.clear();
+
+    // No SQL injection. id of account is controlled by the database.
+    if (QueryResult* result = LoginDatabase.PQuery("SELECT realmid, numchars FROM realmcharacters WHERE acctid = '%u'", _accountId))
+    {
+        do
+        {
+            Field* fields = result->Fetch();
+            _realmCharacters[fields[0].GetUInt32()] = fields[1].GetUInt8();
+        }
+        while (result->NextRow());
+
+        delete result;
+    }
+
+    sRealmList.CacheCharacters(_accountId, _realmCharacters);
+}
 
-    ///- Circle through realms in the RealmList and construct the return packet (including # of user characters in each realm)
-    ByteBuffer pkt;
-    LoadRealmlist(pkt, id);
+void AuthSocket::_RealmListFinish()
+{
+    LoadRealmlist(_deferredReply);
+}
 
-    ByteBuffer hdr;
-    hdr << (uint8) CMD_REALM_LIST;
-    hdr << (uint16)pkt.size();
-    hdr.append(pkt);
+/// Build the realm list packet from the serialized list for the client build, only the character amounts are per account
+void AuthSocket::LoadRealmlist(ByteBuffer& pkt)
+{
+    RealmListTemplate const* tmpl = sRealmList.FindTemplate(_build, _accountSecurityLevel);
+    if (!tmpl)
+    {
+        RealmListTemplate& newTmpl = sRealmList.AddTemplate(_build, _accountSecurityLevel);
+        BuildRealmListTemplate(newTmpl);
+        tmpl = &newTmpl;
+    }
 
-    send((char const*)hdr.contents(), hdr.size());
+    pkt << (uint8) CMD_REALM_LIST;
+    pkt << (uint16) tmpl->packet.size();
 
-    return true;
+    size_t bodyPos = pkt.wpos();
+    pkt.append(tmpl->packet);
+
+    for (std::vector<RealmListTemplate::CharactersPos>::const_iterator itr = tmpl->characters.begin(); itr != tmpl->characters.end(); ++itr)
+    {
+        RealmList::RealmCharacters::const_iterator chars = _realmCharacters.find(itr->second);
+        if (chars != _realmCharacters.end())
+            pkt.put<uint8>(bodyPos + itr->first, chars->second);
+    }
 }
 
-void AuthSocket::LoadRealmlist(ByteBuffer& pkt, uint32 acctid)
+void AuthSocket::BuildRealmListTemplate(RealmListTemplate& tmpl)
 {
+    ByteBuffer& pkt = tmpl.packet;
+
     switch (_build)
     {
         case 5875:                                          // 1.12.1
@@ -902,19 +1052,6 @@ void AuthSocket::LoadRealmlist(ByteBuffer& pkt, uint32 acctid)
 
             for (RealmList::RealmMap::const_iterator  i = sRealmList.begin(); i != sRealmList.end(); ++i)
             {
-                uint8 AmountOfCharacters;
-
-                // No SQL injection. id of realm is controlled by the database.
-                QueryResult* result = LoginDatabase.PQuery("SELECT numchars FROM realmcharacters WHERE realmid = '%d' AND acctid='%u'", i->second.m_ID, acctid);
-                if (result)
-                {
-                    Field* fields = result->Fetch();
-                    AmountOfCharacters = fields[0].GetUInt8();
-                    delete result;
-                }
-                else
-                    AmountOfCharacters = 0;
-
                 bool ok_build = std::find(i->second.realmbuilds.begin(), i->second.realmbuilds.end(), _build) != i->second.realmbuilds.end();
 
                 RealmBuildInfo const* buildInfo = ok_build ? FindBuildInfo(_build) : NULL;
@@ -941,7 +1078,8 @@ void AuthSocket::LoadRealmlist(ByteBuffer& pkt, uint32 acctid)
                 pkt << name;                                // name
                 pkt << i->second.address;                   // address
                 pkt << float(i->second.populationLevel);
-                pkt << uint8(AmountOfCharacters);
+                tmpl.characters.push_back(RealmListTemplate::CharactersPos(pkt.wpos(), i->second.m_ID));
+                pkt << uint8(0);                            // amount of characters, set per account
                 pkt << uint8(i->second.timezone);           // realm category
                 pkt << uint8(0x00);                         // unk, may be realm number/id?
             }
@@ -963,19 +1101,6 @@ void AuthSocket::LoadRealmlist(ByteBuffer& pkt, uint32 acctid)
 
             for (RealmList::RealmMap::const_iterator  i = sRealmList.begin(); i != sRealmList.end(); ++i)
             {
-                uint8 AmountOfCharacters;
-
-                // No SQL injection. id of realm is controlled by the database.
-                QueryResult* result = LoginDatabase.PQuery("SELECT numchars FROM realmcharacters WHERE realmid = '%d' AND acctid='%u'", i->second.m_ID, acctid);
-                if (result)
-                {
-                    Field* fields = result->Fetch();
-                    AmountOfCharacters = fields[0].GetUInt8();
-                    delete result;
-                }
-                else
-                    AmountOfCharacters = 0;
-
                 bool ok_build = std::find(i->second.realmbuilds.begin(), i->second.realmbuilds.end(), _build) != i->second.realmbuilds.end();
 
                 RealmBuildInfo const* buildInfo = ok_build ? FindBuildInfo(_build) : NULL;
@@ -999,7 +1124,8 @@ void AuthSocket::LoadRealmlist(ByteBuffer& pkt, uint32 acctid)
                 pkt << i->first;                            // name
                 pkt << i->second.address;                   // address
                 pkt << float(i->second.populationLevel);
-                pkt << uint8(AmountOfCharacters);
+                tmpl.characters.push_back(RealmListTemplate::CharactersPos(pkt.wpos(), i->second.m_ID));
+                pkt << uint8(0);                            // amount of characters, set per account
                 pkt << uint8(i->second.timezone);           // realm category (Cfg_Categories.dbc)
                 pkt << uint8(0x2C);                         // unk, may be realm number/id?
 
@@ -29,6 +29,7 @@
 #include "ByteBuffer.h"
 
 #include "BufferedSocket.h"
+#include "RealmList.h"
 
 /// Handle login commands
 class AuthSocket: public BufferedSocket
@@ -41,8 +42,14 @@ class AuthSocket: public BufferedSocket
 
         void OnAccept() override;
         void OnRead() override;
-        void SendProof(Sha1Hash sha);
-        void LoadRealmlist(ByteBuffer& pkt, uint32 acctid);
+        void BuildProof(ByteBuffer& pkt, Sha1Hash sha);
+        void LoadRealmlist(ByteBuffer& pkt);
+        void BuildRealmListTemplate(RealmListTemplate& tmpl);
+
+        /// Called by AuthWorkerPool threads: execute the blocking step of the current request
+        void RunDeferred();
+        /// Continuation of a deferred request on the reactor thread
+        int handle_exception(ACE_HANDLE) override;
 
         bool _HandleLogonChallenge();
         bool _HandleLogonProof();
@@ -58,6 +65,17 @@ class AuthSocket: public BufferedSocket
         void _SetVSFields(const std::string& rI);
 
     private:
+        typedef void (AuthSocket::*DeferredStep)();
+
+        bool Defer(DeferredStep work, DeferredStep finish = NULL);
+        bool CompleteDeferred(DeferredStep finish);
+
+        // blocking parts of the handlers above, executed by Defer()
+        void _LogonChallengeWork();
+        void _LogonProofWork();
+        void _ReconnectChallengeWork();
+        void _RealmListWork();
+        void _RealmListFinish();
 
         BigNumber N, s, g, v;
         BigNumber b, B;
@@ -68,6 +86,7 @@ class AuthSocket: public BufferedSocket
 
         std::string _login;
         std::string _safelogin;
+        uint32 _accountId;
 
         // Since GetLocaleByName() is _NOT_ bijective, we have to store the locale as a string. Otherwise we can't differ
         // between enUS and enGB, which is important for the patch system
@@ -78,6 +97,15 @@ class AuthSocket: public BufferedSocket
         ACE_HANDLE patch_;
 
         void InitPatch();
+
+        // request in processing by a worker thread, input is not handled meanwhile
+        DeferredStep _deferredWork;
+        DeferredStep _deferredFinish;
+        ByteBuffer _deferredRequest;
+        ByteBuffer _deferredReply;
+        bool _deferredClose;
+
+        RealmList::RealmCharacters _realmCharacters;
 };
 #endif
 /// @}
@@ -0,0 +1,101 @@
+/*
+ * This file is part of the CMaNGOS Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+/** \file
+  \ingroup realmd
+  */
+
+#include "Common.h"
+#include "Database/DatabaseEnv.h"
+#include "Log.h"
+#include "AuthWorkerPool.h"
+#include "AuthSocket.h"
+
+#include <ace/Singleton.h>
+
+extern DatabaseType LoginDatabase;
+
+AuthWorkerPool::AuthWorkerPool() : threads_(0)
+{
+}
+
+AuthWorkerPool* AuthWorkerPool::instance()
+{
+    return ACE_Singleton<AuthWorkerPool, ACE_Thread_Mutex>::instance();
+}
+
+int AuthWorkerPool::Start(size_t threads)
+{
+    if (threads == 0)
+        return 0;
+
+    if (activate(THR_NEW_LWP | THR_JOINABLE, int(threads)) == -1)
+    {
+        sLog.outError("Can't start auth worker threads");
+        return -1;
+    }
+
+    threads_ = threads;
+
+    sLog.outString("Using %u auth worker threads", uint32(threads));
+    return 0;
+}
+
+void AuthWorkerPool::Stop()
+{
+    if (!threads_)
+        return;
+
+    msg_queue()->close();
+    wait();
+
+    threads_ = 0;
+}
+
+bool AuthWorkerPool::Enqueue(AuthSocket* socket)
+{
+    ACE_Message_Block* mb = new ACE_Message_Block(sizeof(AuthSocket*));
+    ACE_OS::memcpy(mb->wr_ptr(), &socket, sizeof(AuthSocket*));
+    mb->wr_ptr(sizeof(AuthSocket*));
+
+    if (putq(mb) == -1)
+    {
+        mb->release();
+        return false;
+    }
+
+    return true;
+}
+
+int AuthWorkerPool::svc(void)
+{
+    LoginDatabase.ThreadStart();
+
+    ACE_Message_Block* mb = NULL;
+    while (getq(mb) != -1)
+    {
+        AuthSocket* socket;
+        ACE_OS::memcpy(&socket, mb->rd_ptr(), sizeof(AuthSocket*));
+        mb->release();
+
+        socket->RunDeferred();
+    }
+
+    LoginDatabase.ThreadEnd();
+    return 0;
+}
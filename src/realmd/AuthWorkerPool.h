@@ -0,0 +1,60 @@
+/*
+ * This file is part of the CMaNGOS Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+/** \file
+  \ingroup realmd
+  */
+
+#ifndef _AUTHWORKERPOOL_H_
+#define _AUTHWORKERPOOL_H_
+
+#include <ace/Task.h>
+
+class AuthSocket;
+
+/**
+ * @brief Thread pool running the blocking steps of auth requests
+ *
+ * Database lookups and SRP6 calculations are executed here instead of the
+ * reactor callback, the socket continues on its reactor thread afterwards
+ * (see AuthSocket::Defer).
+ */
+class AuthWorkerPool: public ACE_Task<ACE_MT_SYNCH>
+{
+    public:
+        AuthWorkerPool();
+
+        static AuthWorkerPool* instance();
+
+        /// Start the worker threads, 0 threads keep all work in the reactor thread
+        int Start(size_t threads);
+        /// Drop queued work and wait for the worker threads to exit
+        void Stop();
+
+        bool IsActive() const { return threads_ > 0; }
+
+        /// Queue the deferred step of the socket for execution by a worker thread
+        bool Enqueue(AuthSocket* socket);
+
+        virtual int svc(void) override;
+
+    private:
+        size_t threads_;
+};
+
+#endif /* _AUTHWORKERPOOL_H_ */
@@ -33,8 +33,11 @@
 
 BufferedSocket::BufferedSocket(void):
     input_buffer_(4096),
+    closed_(false),
     remote_address_("<unknown>")
 {
+    // handlers may be kept alive by pending work after the reactor dropped them
+    reference_counting_policy().value(ACE_Event_Handler::Reference_Counting_Policy::ENABLED);
 }
 
 /*virtual*/ BufferedSocket::~BufferedSocket(void)
@@ -59,6 +62,20 @@ BufferedSocket::BufferedSocket(void):
 
     this->OnAccept();
 
+    // reactor takes care of the socket from now on
+    this->remove_reference();
+
+    return 0;
+}
+
+/*virtual*/ int BufferedSocket::close(u_long /*flags*/)
+{
+    this->shutdown();
+
+    this->closed_ = true;
+
+    this->remove_reference();
+
     return 0;
 }
 
@@ -240,17 +257,24 @@ bool BufferedSocket::send(const char* buf, size_t len)
 
     this->input_buffer_.wr_ptr((size_t)n);
 
+    this->resume_input();
+
+    // return 1 in case there might be more data to read from OS
+    return n == space ? 1 : 0;
+}
+
+void BufferedSocket::resume_input(void)
+{
     this->OnRead();
 
     // move data in the buffer to the beginning of the buffer
     this->input_buffer_.crunch();
-
-    // return 1 in case there might be more data to read from OS
-    return n == space ? 1 : 0;
 }
 
 /*virtual*/ int BufferedSocket::handle_close(ACE_HANDLE /*h*/, ACE_Reactor_Mask /*m*/)
 {
+    this->closed_ = true;
+
     this->OnClose();
 
     Base::handle_close();
@@ -260,6 +284,8 @@ bool BufferedSocket::send(const char* buf, size_t len)
 
 void BufferedSocket::close_connection(void)
 {
+    this->closed_ = true;
+
     this->peer().close_reader();
     this->peer().close_writer();
 
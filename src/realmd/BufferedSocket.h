@@ -55,8 +55,10 @@ class BufferedSocket: public ACE_Svc_Handler<ACE_SOCK_STREAM, ACE_NULL_SYNCH>
         const std::string& get_remote_address(void) const;
 
         virtual int open(void*) override;
+        virtual int close(u_long flags = 0) override;
 
         void close_connection(void);
+        bool is_closed(void) const { return closed_; }
 
         virtual int handle_input(ACE_HANDLE = ACE_INVALID_HANDLE) override;
         virtual int handle_output(ACE_HANDLE = ACE_INVALID_HANDLE) override;
@@ -64,11 +66,16 @@ class BufferedSocket: public ACE_Svc_Handler<ACE_SOCK_STREAM, ACE_NULL_SYNCH>
         virtual int handle_close(ACE_HANDLE = ACE_INVALID_HANDLE,
                                  ACE_Reactor_Mask = ACE_Event_Handler::ALL_EVENTS_MASK);
 
+    protected:
+        /// process data already buffered, for handlers that paused reading in OnRead
+        void resume_input(void);
+
     private:
         ssize_t noblk_send(ACE_Message_Block& message_block);
 
     private:
         ACE_Message_Block input_buffer_;
+        bool closed_;
 
     protected:
         std::string remote_address_;
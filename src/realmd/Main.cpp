@@ -27,6 +27,8 @@
 #include "Config/Config.h"
 #include "Log.h"
 #include "AuthSocket.h"
+#include "AuthWorkerPool.h"
+#include "PatchHandler.h"
 #include "SystemConfig.h"
 #include "revision.h"
 #include "revision_nr.h"
@@ -241,7 +243,7 @@ extern int main(int argc, char** argv)
     }
 
     ///- Get the list of realms for the server
-    sRealmList.Initialize(sConfig.GetIntDefault("RealmsStateUpdateDelay", 20));
+    sRealmList.Initialize(sConfig.GetIntDefault("RealmsStateUpdateDelay", 20), sConfig.GetIntDefault("RealmCharactersCacheTime", 10));
     if (sRealmList.size() == 0)
     {
         sLog.outError("No valid realms specified.");
@@ -256,6 +258,15 @@ extern int main(int argc, char** argv)
     LoginDatabase.Execute("DELETE FROM ip_banned WHERE unbandate<=UNIX_TIMESTAMP() AND unbandate<>bandate");
     LoginDatabase.CommitTransaction();
 
+    ///- Start the threads executing database lookups and SRP6 calculations of auth requests
+    if (AuthWorkerPool::instance()->Start(sConfig.GetIntDefault("AuthWorkerThreads", 2)) == -1)
+    {
+        Log::WaitBeforeContinueIfNeed();
+        return 1;
+    }
+
+    PatchHandler::SetRateLimit(sConfig.GetIntDefault("PatchDownloadRate", 0) * 1024);
+
     ///- Launch the listening network socket
     ACE_Acceptor<AuthSocket, ACE_SOCK_Acceptor> acceptor;
 
@@ -348,7 +359,8 @@ extern int main(int argc, char** argv)
 #endif
     }
 
-    ///- Wait for the delay thread to exit
+    ///- Wait for the auth workers and the delay thread to exit
+    AuthWorkerPool::instance()->Stop();
     LoginDatabase.HaltDelayThread();
 
     ///- Remove signal handling before leaving
@@ -388,9 +400,11 @@ bool StartDB()
         return false;
     }
 
-    sLog.outString("Login Database total connections: %i", 1 + 1);
+    int nConnections = sConfig.GetIntDefault("LoginDatabaseConnections", 2);
+
+    sLog.outString("Login Database total connections: %i", nConnections + 1);
 
-    if (!LoginDatabase.Initialize(dbstring.c_str()))
+    if (!LoginDatabase.Initialize(dbstring.c_str(), nConnections))
     {
         sLog.outError("Cannot connect to database");
         return false;
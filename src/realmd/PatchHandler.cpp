@@ -29,6 +29,9 @@
 #include <ace/OS_NS_dirent.h>
 #include <ace/OS_NS_errno.h>
 #include <ace/OS_NS_unistd.h>
+#include <ace/OS_NS_sys_stat.h>
+#include <ace/OS_NS_sys_sendfile.h>
+#include <ace/Reactor.h>
 
 #include <ace/os_include/netinet/os_tcp.h>
 
@@ -36,30 +39,18 @@
 #define MSG_NOSIGNAL 0
 #endif
 
-#if defined( __GNUC__ )
-#pragma pack(1)
-#else
-#pragma pack(push,1)
-#endif
+#define PATCH_CHUNK_SIZE    4096                            // 4096 - page size on most arch
+#define PATCH_PACING_MS     100                             // interval of the send budget refill
 
-struct Chunk
-{
-    ACE_UINT8 cmd;
-    ACE_UINT16 data_size;
-    ACE_UINT8 data[4096]; // 4096 - page size on most arch
-};
-
-#if defined( __GNUC__ )
-#pragma pack()
-#else
-#pragma pack(pop)
-#endif
+size_t PatchHandler::rate_limit_ = 0;
 
-PatchHandler::PatchHandler(ACE_HANDLE socket, ACE_HANDLE patch)
+PatchHandler::PatchHandler(ACE_HANDLE socket, ACE_HANDLE patch) :
+    patch_fd_(patch), offset_(0), file_size_(0),
+    header_sent_(sizeof(PatchChunkHeader)), chunk_left_(0),
+    budget_(0), registered_(false), paused_(false)
 {
     reactor(NULL);
     set_handle(socket);
-    patch_fd_ = patch;
 }
 
 PatchHandler::~PatchHandler()
@@ -93,41 +84,93 @@ int PatchHandler::open(void*)
     }
 #endif // TCP_CORK
 
-    (void) peer().disable(ACE_NONBLOCK);
+    // transfer may be resumed from the middle of the file
+    file_size_ = ACE_OS::filesize(patch_fd_);
+    offset_ = ACE_OS::lseek(patch_fd_, 0, SEEK_CUR);
 
-    return activate(THR_NEW_LWP | THR_DETACHED | THR_INHERIT_SCHED);
-}
+    if (file_size_ == -1 || offset_ == -1)
+        return -1;
 
-int PatchHandler::svc(void)
-{
-    // Do 1 second sleep, similar to the one in game/WorldSocket.cpp
+    reactor(ACE_Reactor::instance());
+
+    // Do 1 second delay, similar to the one in game/WorldSocket.cpp
     // Seems client have problems with too fast sends.
-    ACE_OS::sleep(1);
+    ACE_Time_Value interval = rate_limit_ ? ACE_Time_Value(0, PATCH_PACING_MS * 1000) : ACE_Time_Value::zero;
 
-    int flags = MSG_NOSIGNAL;
+    if (reactor()->schedule_timer(this, NULL, ACE_Time_Value(1), interval) == -1)
+        return -1;
 
-    Chunk data;
-    data.cmd = CMD_XFER_DATA;
+    return 0;
+}
 
-    ssize_t r;
+int PatchHandler::handle_timeout(const ACE_Time_Value& /*current_time*/, const void* /*act*/)
+{
+    budget_ = rate_limit_ * PATCH_PACING_MS / IN_MILLISECONDS;
 
-    while ((r = ACE_OS::read(patch_fd_, data.data, sizeof(data.data))) > 0)
+    if (!registered_)
     {
-        data.data_size = (ACE_UINT16)r;
+        if (reactor()->register_handler(this, ACE_Event_Handler::WRITE_MASK) == -1)
+            return -1;
 
-        if (peer().send((const char*)&data,
-                        ((size_t) r) + sizeof(data) - sizeof(data.data),
-                        flags) == -1)
-        {
+        registered_ = true;
+    }
+    else if (paused_)
+    {
+        if (reactor()->schedule_wakeup(this, ACE_Event_Handler::WRITE_MASK) == -1)
             return -1;
-        }
+
+        paused_ = false;
     }
 
-    if (r == -1)
+    return 0;
+}
+
+int PatchHandler::handle_output(ACE_HANDLE)
+{
+    while (!rate_limit_ || budget_ > 0)
     {
-        return -1;
+        ///- Begin the next chunk when the current one is sent completely
+        if (header_sent_ == sizeof(header_) && chunk_left_ == 0)
+        {
+            // transfer finished, handle_close() releases the handler
+            if (offset_ >= file_size_)
+                return -1;
+
+            chunk_left_ = std::min(size_t(file_size_ - offset_), size_t(PATCH_CHUNK_SIZE));
+            header_.cmd = CMD_XFER_DATA;
+            header_.data_size = ACE_UINT16(chunk_left_);
+            header_sent_ = 0;
+        }
+
+        ssize_t n;
+
+        if (header_sent_ < sizeof(header_))
+        {
+            n = peer().send((const char*)&header_ + header_sent_, sizeof(header_) - header_sent_, MSG_NOSIGNAL);
+            if (n > 0)
+                header_sent_ += n;
+        }
+        else
+        {
+            // chunk data goes from the file to the socket without a copy in user space
+            n = ACE_OS::sendfile(get_handle(), patch_fd_, &offset_, chunk_left_);
+            if (n > 0)
+                chunk_left_ -= n;
+        }
+
+        if (n < 0)
+            return errno == EWOULDBLOCK ? 0 : -1;
+        else if (n == 0)
+            return -1;
+
+        if (rate_limit_)
+            budget_ -= std::min(budget_, size_t(n));
     }
 
+    // budget of this interval is used up, continue at the next timer tick
+    paused_ = true;
+    reactor()->cancel_wakeup(this, ACE_Event_Handler::WRITE_MASK);
+
     return 0;
 }
 
@@ -152,6 +195,21 @@ void PatchCache::LoadPatchMD5(const char* szFileName)
     // Try to open the patch file
     std::string path = "./patches/";
     path += szFileName;
+
+    ACE_stat st;
+    if (ACE_OS::stat(path.c_str(), &st) == -1)
+        return;
+
+    // Reuse the hash calculated at a previous start if the patch is unchanged
+    ACE_UINT8 md5[MD5_DIGEST_LENGTH];
+    if (ReadCachedMD5(path, st.st_size, st.st_mtime, md5))
+    {
+        sLog.outDebug("Loaded cached patch info for %s", path.c_str());
+        patches_[path] = new PATCH_INFO;
+        memcpy(patches_[path]->md5, md5, MD5_DIGEST_LENGTH);
+        return;
+    }
+
     FILE* pPatch = fopen(path.c_str(), "rb");
     sLog.outDebug("Loading patch info from %s", path.c_str());
 
@@ -177,6 +235,54 @@ void PatchCache::LoadPatchMD5(const char* szFileName)
     // Store the result in the internal patch hash map
     patches_[path] = new PATCH_INFO;
     MD5_Final((ACE_UINT8*) & patches_[path]->md5, &ctx);
+
+    WriteCachedMD5(path, st.st_size, st.st_mtime, patches_[path]->md5);
+}
+
+bool PatchCache::ReadCachedMD5(const std::string& path, ACE_OFF_T size, time_t mtime, ACE_UINT8 md5[MD5_DIGEST_LENGTH])
+{
+    std::string cachePath = path + ".md5";
+    FILE* pCache = fopen(cachePath.c_str(), "r");
+    if (!pCache)
+        return false;
+
+    // format: <size> <mtime> <md5 hex>
+    unsigned long long cachedSize, cachedTime;
+    char hex[MD5_DIGEST_LENGTH * 2 + 1];
+    bool valid = fscanf(pCache, "%llu %llu %32s", &cachedSize, &cachedTime, hex) == 3 &&
+                 cachedSize == (unsigned long long)size && cachedTime == (unsigned long long)mtime &&
+                 strlen(hex) == MD5_DIGEST_LENGTH * 2;
+
+    fclose(pCache);
+
+    for (int i = 0; valid && i < MD5_DIGEST_LENGTH; ++i)
+    {
+        unsigned int byte;
+        if (sscanf(&hex[i * 2], "%2x", &byte) != 1)
+            valid = false;
+        else
+            md5[i] = ACE_UINT8(byte);
+    }
+
+    return valid;
+}
+
+void PatchCache::WriteCachedMD5(const std::string& path, ACE_OFF_T size, time_t mtime, const ACE_UINT8 md5[MD5_DIGEST_LENGTH])
+{
+    std::string cachePath = path + ".md5";
+    FILE* pCache = fopen(cachePath.c_str(), "w");
+    if (!pCache)
+    {
+        sLog.outDebug("Can't write patch info cache %s", cachePath.c_str());
+        return;
+    }
+
+    fprintf(pCache, "%llu %llu ", (unsigned long long)size, (unsigned long long)mtime);
+    for (int i = 0; i < MD5_DIGEST_LENGTH; ++i)
+        fprintf(pCache, "%02x", md5[i]);
+    fprintf(pCache, "\n");
+
+    fclose(pCache);
 }
 
 bool PatchCache::GetHash(const char* pat, ACE_UINT8 mymd5[MD5_DIGEST_LENGTH])
@@ -67,9 +67,37 @@ class PatchCache
 
     private:
         void LoadPatchesInfo();
+        // MD5 stored next to the patch as <patch>.md5, valid while patch size and modification time match
+        bool ReadCachedMD5(const std::string& path, ACE_OFF_T size, time_t mtime, ACE_UINT8 md5[MD5_DIGEST_LENGTH]);
+        void WriteCachedMD5(const std::string& path, ACE_OFF_T size, time_t mtime, const ACE_UINT8 md5[MD5_DIGEST_LENGTH]);
+
         Patches patches_;
 };
 
+#if defined( __GNUC__ )
+#pragma pack(1)
+#else
+#pragma pack(push,1)
+#endif
+
+struct PatchChunkHeader
+{
+    ACE_UINT8 cmd;
+    ACE_UINT16 data_size;
+};
+
+#if defined( __GNUC__ )
+#pragma pack()
+#else
+#pragma pack(pop)
+#endif
+
+/**
+ * @brief Sends a patch file to the client from the reactor thread
+ *
+ * Chunk data is passed from the file to the socket by sendfile, transfer
+ * speed of each download is limited by a send budget refilled by a timer.
+ */
 class PatchHandler: public ACE_Svc_Handler<ACE_SOCK_STREAM, ACE_NULL_SYNCH>
 {
     protected:
@@ -81,11 +109,26 @@ class PatchHandler: public ACE_Svc_Handler<ACE_SOCK_STREAM, ACE_NULL_SYNCH>
 
         int open(void* = 0) override;
 
-    protected:
-        virtual int svc(void) override;
+        int handle_output(ACE_HANDLE = ACE_INVALID_HANDLE) override;
+        int handle_timeout(const ACE_Time_Value& current_time, const void* act = 0) override;
+
+        /// Bytes per second sent to each client, 0 for no limit
+        static void SetRateLimit(size_t bytes_per_second) { rate_limit_ = bytes_per_second; }
 
     private:
         ACE_HANDLE patch_fd_;
+        off_t offset_;                                      // file position of the next data to send
+        off_t file_size_;
+
+        PatchChunkHeader header_;                           // header of the chunk in transfer
+        size_t header_sent_;
+        size_t chunk_left_;                                 // chunk data not sent yet
+
+        size_t budget_;                                     // bytes allowed until the next timer tick
+        bool registered_;
+        bool paused_;
+
+        static size_t rate_limit_;
 };
 
 #endif /* _BK_PATCHHANDLER_H__ */
@@ -64,7 +64,8 @@ RealmBuildInfo const* FindBuildInfo(uint16 _build)
     return NULL;
 }
 
-RealmList::RealmList() : m_UpdateInterval(0), m_NextUpdateTime(time(NULL))
+RealmList::RealmList() : m_UpdateInterval(0), m_NextUpdateTime(time(NULL)),
+    m_CharactersCacheTime(0), m_NextCachePruneTime(time(NULL))
 {
 }
 
@@ -75,9 +76,10 @@ RealmList& sRealmList
 }
 
 /// Load the realm list from the database
-void RealmList::Initialize(uint32 updateInterval)
+void RealmList::Initialize(uint32 updateInterval, uint32 charactersCacheTime)
 {
     m_UpdateInterval = updateInterval;
+    m_CharactersCacheTime = charactersCacheTime;
 
     ///- Get the content of the realmlist table in the database
     UpdateRealms(true);
@@ -133,6 +135,7 @@ void RealmList::UpdateIfNeed()
 
     // Clears Realm list
     m_realms.clear();
+    m_templates.clear();
 
     // Get the content of the realmlist table in the database
     UpdateRealms(false);
@@ -176,3 +179,60 @@ void RealmList::UpdateRealms(bool init)
         delete result;
     }
 }
+
+bool RealmList::GetCachedCharacters(uint32 accountId, RealmCharacters& characters)
+{
+    if (!m_CharactersCacheTime)
+        return false;
+
+    ACE_GUARD_RETURN(ACE_Thread_Mutex, guard, m_charactersCacheLock, false);
+
+    CharactersCacheMap::const_iterator itr = m_charactersCache.find(accountId);
+    if (itr == m_charactersCache.end() || itr->second.expireTime <= time(NULL))
+        return false;
+
+    characters = itr->second.characters;
+    return true;
+}
+
+void RealmList::CacheCharacters(uint32 accountId, RealmCharacters const& characters)
+{
+    if (!m_CharactersCacheTime)
+        return;
+
+    time_t now = time(NULL);
+
+    ACE_GUARD(ACE_Thread_Mutex, guard, m_charactersCacheLock);
+
+    // drop entries of accounts not requesting the realm list anymore
+    if (m_NextCachePruneTime <= now)
+    {
+        for (CharactersCacheMap::iterator itr = m_charactersCache.begin(); itr != m_charactersCache.end();)
+        {
+            if (itr->second.expireTime <= now)
+                m_charactersCache.erase(itr++);
+            else
+                ++itr;
+        }
+
+        m_NextCachePruneTime = now + m_CharactersCacheTime;
+    }
+
+    CachedCharacters& cached = m_charactersCache[accountId];
+    cached.characters = characters;
+    cached.expireTime = now + m_CharactersCacheTime;
+}
+
+RealmListTemplate const* RealmList::FindTemplate(uint16 build, AccountTypes security) const
+{
+    RealmListTemplateMap::const_iterator itr = m_templates.find(std::make_pair(build, uint8(security)));
+    return itr != m_templates.end() ? &itr->second : NULL;
+}
+
+RealmListTemplate& RealmList::AddTemplate(uint16 build, AccountTypes security)
+{
+    RealmListTemplate& tmpl = m_templates[std::make_pair(build, uint8(security))];
+    tmpl.packet.clear();
+    tmpl.characters.clear();
+    return tmpl;
+}
@@ -24,6 +24,7 @@
 #define _REALMLIST_H
 
 #include "Common.h"
+#include "ByteBuffer.h"
 
 struct RealmBuildInfo
 {
@@ -52,21 +53,39 @@ struct Realm
     RealmBuildInfo realmBuildInfo;                          // build info for show version in list
 };
 
+/// Realm list packet serialized for one client build and account security level
+struct RealmListTemplate
+{
+    typedef std::pair<size_t, uint32> CharactersPos;        // packet position of the character amount, realm id
+
+    ByteBuffer packet;
+    std::vector<CharactersPos> characters;
+};
+
 /// Storage object for the list of realms on the server
 class RealmList
 {
     public:
         typedef std::map<std::string, Realm> RealmMap;
+        typedef std::map<uint32, uint8> RealmCharacters;    // realm id -> amount of account characters
 
         static RealmList& Instance();
 
         RealmList();
         ~RealmList() {}
 
-        void Initialize(uint32 updateInterval);
+        void Initialize(uint32 updateInterval, uint32 charactersCacheTime);
 
         void UpdateIfNeed();
 
+        // character amounts per account, thread safe
+        bool GetCachedCharacters(uint32 accountId, RealmCharacters& characters);
+        void CacheCharacters(uint32 accountId, RealmCharacters const& characters);
+
+        // serialized realm lists, reset on realm list update
+        RealmListTemplate const* FindTemplate(uint16 build, AccountTypes security) const;
+        RealmListTemplate& AddTemplate(uint16 build, AccountTypes security);
+
         RealmMap::const_iterator begin() const { return m_realms.begin(); }
         RealmMap::const_iterator end() const { return m_realms.end(); }
         uint32 size() const { return m_realms.size(); }
@@ -77,6 +96,21 @@ class RealmList
         RealmMap m_realms;                                  ///< Internal map of realms
         uint32   m_UpdateInterval;
         time_t   m_NextUpdateTime;
+
+        typedef std::map<std::pair<uint16, uint8>, RealmListTemplate> RealmListTemplateMap;
+        RealmListTemplateMap m_templates;                   ///< Realm list packets by (client build, security level)
+
+        struct CachedCharacters
+        {
+            RealmCharacters characters;
+            time_t expireTime;
+        };
+
+        typedef UNORDERED_MAP<uint32, CachedCharacters> CharactersCacheMap;
+        CharactersCacheMap m_charactersCache;               ///< Character amounts by account id
+        ACE_Thread_Mutex m_charactersCacheLock;
+        uint32   m_CharactersCacheTime;
+        time_t   m_NextCachePruneTime;
 };
 
 #define sRealmList RealmList::Instance()
@@ -65,6 +65,15 @@ class ByteBuffer
         // copy constructor
         ByteBuffer(const ByteBuffer& buf): _rpos(buf._rpos), _wpos(buf._wpos), _storage(buf._storage) { }
 
+        // copy assignment
+        ByteBuffer& operator=(const ByteBuffer& buf)
+        {
+            _rpos = buf._rpos;
+            _wpos = buf._wpos;
+            _storage = buf._storage;
+            return *this;
+        }
+
         void clear()
         {
             _storage.clear();
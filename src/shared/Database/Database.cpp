@@ -77,6 +77,14 @@ SqlPreparedStatement* SqlConnection::GetStmt(uint32 nIndex)
     return pStmt;
 }
 
+void SqlConnection::QueryBatch(std::vector<const char*> const& sqls, std::vector<QueryResult*>& results)
+{
+    results.assign(sqls.size(), (QueryResult*)NULL);
+    for (size_t i = 0; i < sqls.size(); ++i)
+        if (sqls[i])
+            results[i] = Query(sqls[i]);
+}
+
 bool SqlConnection::ExecuteStmt(int nIndex, const SqlStmtParameters& id)
 {
     if (nIndex == -1)
@@ -148,7 +156,8 @@ void Database::StopServer()
 {
     HaltDelayThread();
 
-    delete m_pResultQueue;
+    if (m_pResultQueue)
+        m_pResultQueue->Release();
     delete m_pAsyncConn;
 
     m_pResultQueue = NULL;
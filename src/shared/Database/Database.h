@@ -48,6 +48,8 @@ class MANGOS_DLL_SPEC SqlConnection
         // public methods for making queries
         virtual QueryResult* Query(const char* sql) = 0;
         virtual QueryNamedResult* QueryNamed(const char* sql) = 0;
+        // run several queries, results[i] is set for sqls[i] (NULL queries are skipped), by default one after another
+        virtual void QueryBatch(std::vector<const char*> const& sqls, std::vector<QueryResult*>& results);
 
         // public methods for making requests
         virtual bool Execute(const char* sql) = 0;
@@ -207,8 +209,10 @@ class MANGOS_DLL_SPEC Database
         // must be called before finish thread run (one time for thread using one from existing Database objects)
         virtual void ThreadEnd();
 
-        // set database-wide result queue. also we should use object-bases and not thread-based result queues
+        // run callbacks of the database-wide result queue, async queries issued inside a SqlResultQueueScope of this database use the queue of that scope
         void ProcessResultQueue();
+        // database-wide result queue, processed by the world thread
+        SqlResultQueue* GetResultQueue() const { return m_pResultQueue; }
 
         bool CheckRequiredField(char const* table_name, char const* required_name);
         uint32 GetPingIntervall() { return m_pingIntervallms; }
@@ -269,6 +273,14 @@ class MANGOS_DLL_SPEC Database
         // for now return one single connection for async requests
         SqlConnection* getAsyncConnection() const { return m_pAsyncConn; }
 
+        // result queue of async queries issued now by the current thread
+        SqlResultQueue* GetCurrentResultQueue()
+        {
+            SqlResultQueue* queue = *m_scopedResultQueue;
+            return queue ? queue : m_pResultQueue;
+        }
+
+        friend class SqlResultQueueScope;
         friend class SqlStatement;
         // PREPARED STATEMENT API
         // query function for prepared statements
@@ -287,6 +299,7 @@ class MANGOS_DLL_SPEC Database
         SqlConnection* m_pAsyncConn;
 
         SqlResultQueue*     m_pResultQueue;                 ///< Transaction queues from diff. threads
+        ACE_TSS<ACE_TSS_Type_Adapter<SqlResultQueue*> > m_scopedResultQueue;    ///< Queue of the innermost SqlResultQueueScope of the thread
         SqlDelayThread*     m_threadBody;                   ///< Pointer to delay sql executer (owned by m_delayThread)
         ACE_Based::Thread* m_delayThread;                   ///< Pointer to executer thread
 
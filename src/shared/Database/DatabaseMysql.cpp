@@ -134,8 +134,9 @@ bool MySQLConnection::Initialize(const char* infoString)
     }
 #endif
 
+    // multi statements are used by QueryBatch, enabled here to not pay a server round trip per batch
     mMysql = mysql_real_connect(mysqlInit, host.c_str(), user.c_str(),
-                                password.c_str(), database.c_str(), port, unix_socket, 0);
+                                password.c_str(), database.c_str(), port, unix_socket, CLIENT_MULTI_STATEMENTS);
 
     if (!mMysql)
     {
@@ -245,6 +246,77 @@ QueryNamedResult* MySQLConnection::QueryNamed(const char* sql)
     return new QueryNamedResult(queryResult, names);
 }
 
+void MySQLConnection::QueryBatch(std::vector<const char*> const& sqls, std::vector<QueryResult*>& results)
+{
+    results.assign(sqls.size(), (QueryResult*)NULL);
+
+    // join the queries into one multi statement, remembering which result each statement fills
+    std::string batch;
+    std::vector<size_t> slots;
+    for (size_t i = 0; i < sqls.size(); ++i)
+    {
+        if (!sqls[i])
+            continue;
+
+        // a statement with its own separator would shift the results against the slots
+        if (strchr(sqls[i], ';'))
+        {
+            SqlConnection::QueryBatch(sqls, results);
+            return;
+        }
+
+        if (!batch.empty())
+            batch += ';';
+        batch += sqls[i];
+        slots.push_back(i);
+    }
+
+    if (!mMysql || slots.size() < 2)
+    {
+        SqlConnection::QueryBatch(sqls, results);
+        return;
+    }
+
+    uint32 _s = WorldTimer::getMSTime();
+
+    size_t done = 0;
+    int status = mysql_real_query(mMysql, batch.c_str(), (unsigned long)batch.size());
+    if (!status)
+    {
+        do
+        {
+            MYSQL_RES* result = mysql_store_result(mMysql);
+            uint64 rowCount = mysql_affected_rows(mMysql);
+            uint32 fieldCount = mysql_field_count(mMysql);
+
+            if (result && rowCount)
+            {
+                QueryResultMysql* queryResult = new QueryResultMysql(result, mysql_fetch_fields(result), rowCount, fieldCount);
+                queryResult->NextRow();
+                results[slots[done]] = queryResult;
+            }
+            else if (result)
+                mysql_free_result(result);
+
+            ++done;
+        }
+        while (done < slots.size() && (status = mysql_next_result(mMysql)) == 0);
+
+        // read any result left, the connection is out of sync until all are consumed
+        while (!status && (status = mysql_next_result(mMysql)) == 0)
+        {
+            if (MYSQL_RES* result = mysql_store_result(mMysql))
+                mysql_free_result(result);
+        }
+    }
+
+    DEBUG_FILTER_LOG(LOG_FILTER_SQL_TEXT, "[%u ms] SQL batch of " SIZEFMTD " queries, " SIZEFMTD " done", WorldTimer::getMSTimeDiff(_s, WorldTimer::getMSTime()), slots.size(), done);
+
+    // the server stops at the first failing statement, the rest runs alone and reports its own errors
+    for (; done < slots.size(); ++done)
+        results[slots[done]] = Query(sqls[slots[done]]);
+}
+
 bool MySQLConnection::Execute(const char* sql)
 {
     if (!mMysql)
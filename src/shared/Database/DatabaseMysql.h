@@ -78,6 +78,7 @@ class MANGOS_DLL_SPEC MySQLConnection : public SqlConnection
 
         QueryResult* Query(const char* sql) override;
         QueryNamedResult* QueryNamed(const char* sql) override;
+        void QueryBatch(std::vector<const char*> const& sqls, std::vector<QueryResult*>& results) override;
         bool Execute(const char* sql) override;
 
         unsigned long escape_string(char* to, const char* from, unsigned long length);
@@ -19,11 +19,20 @@
 #include "Database/SqlDelayThread.h"
 #include "Database/SqlOperations.h"
 #include "DatabaseEnv.h"
+#include "Timer.h"
 
-SqlDelayThread::SqlDelayThread(Database* db, SqlConnection* conn) : m_dbEngine(db), m_dbConnection(conn), m_running(true)
+SqlDelayThread::SqlDelayThread(Database* db, SqlConnection* conn) : m_dbEngine(db), m_dbConnection(conn), m_running(true),
+    m_latencyCount(0), m_latencyTotal(0), m_latencyMax(0)
 {
 }
 
+bool SqlDelayThread::Delay(SqlOperation* sql)
+{
+    sql->m_queuedTime = WorldTimer::getMSTime();
+    m_sqlQueue.add(sql);
+    return true;
+}
+
 SqlDelayThread::~SqlDelayThread()
 {
     // process all requests which might have been queued while thread was stopping
@@ -53,6 +62,16 @@ void SqlDelayThread::run()
         {
             loopCounter = 0;
             m_dbEngine->Ping();
+
+            if (m_latencyCount)
+            {
+                DEBUG_LOG("SqlDelayThread: %u requests, queue latency avg %u ms max %u ms",
+                          m_latencyCount, uint32(m_latencyTotal / m_latencyCount), m_latencyMax);
+
+                m_latencyCount = 0;
+                m_latencyTotal = 0;
+                m_latencyMax = 0;
+            }
         }
     }
 
@@ -71,6 +90,12 @@ void SqlDelayThread::ProcessRequests()
     SqlOperation* s = NULL;
     while (m_sqlQueue.next(s))
     {
+        uint32 latency = WorldTimer::getMSTimeDiff(s->m_queuedTime, WorldTimer::getMSTime());
+        ++m_latencyCount;
+        m_latencyTotal += latency;
+        if (latency > m_latencyMax)
+            m_latencyMax = latency;
+
         s->Execute(m_dbConnection);
         delete s;
     }
@@ -20,23 +20,27 @@
 #define __SQLDELAYTHREAD_H
 
 #include "ace/Thread_Mutex.h"
-#include "LockedQueue.h"
+#include "LockFreeQueue.h"
 #include "Threading.h"
+#include "Database/SqlOperations.h"
 
 class Database;
-class SqlOperation;
 class SqlConnection;
 
 class SqlDelayThread : public ACE_Based::Runnable
 {
-        typedef ACE_Based::LockedQueue<SqlOperation*, ACE_Thread_Mutex> SqlQueue;
+        typedef ACE_Based::LockFreeQueue<SqlOperation, &SqlOperation::m_next> SqlQueue;
 
     private:
-        SqlQueue m_sqlQueue;                                ///< Queue of SQL statements
+        SqlQueue m_sqlQueue;                                ///< Queue of SQL statements, lock free for the producers
         Database* m_dbEngine;                               ///< Pointer to used Database engine
         SqlConnection* m_dbConnection;                      ///< Pointer to DB connection
         volatile bool m_running;
 
+        uint32 m_latencyCount;                              ///< Requests executed since the last latency report
+        uint64 m_latencyTotal;                              ///< Sum of their queue latency (ms)
+        uint32 m_latencyMax;                                ///< Highest queue latency (ms)
+
         // process all enqueued requests
         void ProcessRequests();
 
@@ -45,7 +49,7 @@ class SqlDelayThread : public ACE_Based::Runnable
         ~SqlDelayThread();
 
         ///< Put sql statement to delay queue
-        bool Delay(SqlOperation* sql) { m_sqlQueue.add(sql); return true; }
+        bool Delay(SqlOperation* sql);
 
         virtual void Stop();                                ///< Stop event
         virtual void run();                                 ///< Main Thread loop
@@ -23,13 +23,18 @@
 
 #define LOCK_DB_CONN(conn) SqlConnection::Lock guard(conn)
 
+/// ---- MEMORY ----
+
+SqlOperationPool<SqlPlainRequest> SqlPlainRequest::s_pool;
+SqlOperationPool<SqlQuery> SqlQuery::s_pool;
+
 /// ---- ASYNC STATEMENTS / TRANSACTIONS ----
 
 bool SqlPlainRequest::Execute(SqlConnection* conn)
 {
     /// just do it
     LOCK_DB_CONN(conn);
-    return conn->Execute(m_sql);
+    return conn->Execute(m_sql.c_str());
 }
 
 SqlTransaction::~SqlTransaction()
@@ -89,9 +94,9 @@ bool SqlQuery::Execute(SqlConnection* conn)
 
     LOCK_DB_CONN(conn);
     /// execute the query and store the result in the callback
-    m_callback->SetResult(conn->Query(m_sql));
+    m_callback->SetResult(conn->Query(m_sql.c_str()));
     /// add the callback to the sql result queue of the thread it originated from
-    m_queue->add(m_callback);
+    m_queue->Deliver(m_callback);
 
     return true;
 }
@@ -107,6 +112,56 @@ void SqlResultQueue::Update()
     }
 }
 
+SqlResultQueue::~SqlResultQueue()
+{
+    if (m_fallback)
+        m_fallback->Release();
+    else
+    {
+        /// the database stopped, nobody will run the callbacks anymore
+        MaNGOS::IQueryCallback* callback = NULL;
+        while (next(callback))
+            delete callback;
+    }
+}
+
+void SqlResultQueue::Deliver(MaNGOS::IQueryCallback* callback)
+{
+    ACE_GUARD(ACE_Thread_Mutex, guard, m_fallbackLock);
+    if (m_fallback)
+        m_fallback->Deliver(callback);
+    else
+        add(callback);
+}
+
+void SqlResultQueue::Detach(SqlResultQueue* fallback)
+{
+    // database already stopped, the callbacks are dropped with the last reference
+    if (fallback)
+    {
+        ACE_GUARD(ACE_Thread_Mutex, guard, m_fallbackLock);
+        MANGOS_ASSERT(!m_fallback && fallback != this);
+        m_fallback = fallback;
+        m_fallback->AddRef();
+
+        MaNGOS::IQueryCallback* callback = NULL;
+        while (next(callback))
+            m_fallback->Deliver(callback);
+    }
+
+    Release();
+}
+
+SqlResultQueueScope::SqlResultQueueScope(Database& db, SqlResultQueue* queue) : m_db(db), m_previous(*db.m_scopedResultQueue)
+{
+    *m_db.m_scopedResultQueue = queue;
+}
+
+SqlResultQueueScope::~SqlResultQueueScope()
+{
+    *m_db.m_scopedResultQueue = m_previous;
+}
+
 bool SqlQueryHolder::Execute(MaNGOS::IQueryCallback* callback, SqlDelayThread* thread, SqlResultQueue* queue)
 {
     if (!callback || !thread || !queue)
@@ -214,15 +269,18 @@ bool SqlQueryHolderEx::Execute(SqlConnection* conn)
     LOCK_DB_CONN(conn);
     /// we can do this, we are friends
     std::vector<SqlQueryHolder::SqlResultPair>& queries = m_holder->m_queries;
+    std::vector<const char*> sqls(queries.size());
     for (size_t i = 0; i < queries.size(); ++i)
-    {
-        /// execute all queries in the holder and pass the results
-        char const* sql = queries[i].first;
-        if (sql) m_holder->SetResult(i, conn->Query(sql));
-    }
+        sqls[i] = queries[i].first;
+
+    /// execute all queries in the holder, in one round trip where the connection supports it, and pass the results
+    std::vector<QueryResult*> results;
+    conn->QueryBatch(sqls, results);
+    for (size_t i = 0; i < queries.size(); ++i)
+        if (sqls[i]) m_holder->SetResult(i, results[i]);
 
     /// sync with the caller thread
-    m_queue->add(m_callback);
+    m_queue->Deliver(m_callback);
 
     return true;
 }
@@ -21,8 +21,11 @@
 
 #include "Common.h"
 
+#include "ace/Atomic_Op.h"
 #include "ace/Thread_Mutex.h"
+#include "ace/TSS_T.h"
 #include "LockedQueue.h"
+#include "LockFreeQueue.h"
 #include <queue>
 #include "Utilities/Callback.h"
 
@@ -35,10 +38,123 @@ class SqlStmtParameters;
 
 class SqlOperation
 {
+        friend class SqlDelayThread;
+
     public:
+        SqlOperation() : m_next(NULL), m_queuedTime(0) {}
         virtual void OnRemove() { delete this; }
         virtual bool Execute(SqlConnection* conn) = 0;
         virtual ~SqlOperation() {}
+
+    private:
+        SqlOperation* m_next;                               ///< Link in the SqlDelayThread queue
+        uint32 m_queuedTime;                                ///< Time the operation was delayed, for queue latency
+};
+
+/// ---- MEMORY ----
+
+/**
+ * Recycles the memory of one SqlOperation type without locking.
+ *
+ * Freed blocks are pushed to a shared lock free stack by whichever thread
+ * deletes the operation (usually the SqlDelayThread). An allocating thread
+ * takes the whole stack at once into its own per-thread free list.
+ */
+template <class T>
+class SqlOperationPool
+{
+        struct Block
+        {
+            Block* next;
+        };
+
+        struct Cache
+        {
+            Cache() : free(NULL) {}
+            ~Cache() { FreeBlocks(free); }
+
+            Block* free;
+        };
+
+    public:
+        ~SqlOperationPool() { FreeBlocks(m_returned.take_all()); }
+
+        void* Allocate(size_t size)
+        {
+            if (size != sizeof(T))
+                return ::operator new(size);
+
+            Cache* cache = m_cache;                         // created on first use by the thread
+
+            if (!cache->free)
+                cache->free = m_returned.take_all();
+
+            if (Block* block = cache->free)
+            {
+                cache->free = block->next;
+                return block;
+            }
+
+            return ::operator new(size);
+        }
+
+        void Deallocate(void* p, size_t size)
+        {
+            if (!p)
+                return;
+
+            if (size != sizeof(T))
+            {
+                ::operator delete(p);
+                return;
+            }
+
+            m_returned.push(static_cast<Block*>(p));
+        }
+
+    private:
+        static void FreeBlocks(Block* block)
+        {
+            while (block)
+            {
+                Block* next = block->next;
+                ::operator delete(block);
+                block = next;
+            }
+        }
+
+        ACE_Based::LockFreeStack<Block, &Block::next> m_returned;
+        ACE_TSS<Cache> m_cache;
+};
+
+/// SQL text of an async operation, short statements are stored inline without heap allocation
+class SqlOperationText
+{
+    public:
+        explicit SqlOperationText(const char* sql)
+        {
+            size_t len = strlen(sql);
+            if (len < INLINE_SIZE)
+            {
+                memcpy(m_inline, sql, len + 1);
+                m_sql = m_inline;
+            }
+            else
+                m_sql = mangos_strdup(sql);
+        }
+
+        ~SqlOperationText() { if (m_sql != m_inline) delete[] m_sql; }
+
+        const char* c_str() const { return m_sql; }
+
+    private:
+        SqlOperationText(SqlOperationText const&);
+        SqlOperationText& operator=(SqlOperationText const&);
+
+        enum { INLINE_SIZE = 256 };
+
+        char* m_sql;
+        char m_inline[INLINE_SIZE];
 };
 
 /// ---- ASYNC STATEMENTS / TRANSACTIONS ----
@@ -46,11 +162,16 @@ class SqlOperation
 class SqlPlainRequest : public SqlOperation
 {
     private:
-        const char* m_sql;
+        SqlOperationText m_sql;
     public:
-        SqlPlainRequest(const char* sql) : m_sql(mangos_strdup(sql)) {}
-        ~SqlPlainRequest() { char* tofree = const_cast<char*>(m_sql); delete[] tofree; }
+        SqlPlainRequest(const char* sql) : m_sql(sql) {}
         bool Execute(SqlConnection* conn) override;
+
+        static void* operator new(size_t size) { return s_pool.Allocate(size); }
+        static void operator delete(void* p, size_t size) { s_pool.Deallocate(p, size); }
+
+    private:
+        static SqlOperationPool<SqlPlainRequest> s_pool;
 };
 
 class SqlTransaction : public SqlOperation
@@ -88,24 +209,69 @@ class SqlResultQueue;                                       /// queue for thread
 class SqlQueryHolder;                                       /// groups several async quries
 class SqlQueryHolderEx;                                     /// points to a holder, added to the delay thread
 
+/**
+ * Callbacks of finished async queries, waiting for the thread that owns them.
+ *
+ * Every database has a default queue processed by the world thread, a map
+ * owns one for the queries issued while it updates. The queries in flight
+ * hold a reference, so an owner going away detaches its queue: callbacks
+ * still waiting or arriving later are passed on to the fallback queue.
+ */
 class SqlResultQueue : public ACE_Based::LockedQueue<MaNGOS::IQueryCallback* , ACE_Thread_Mutex>
 {
     public:
-        SqlResultQueue() {}
+        SqlResultQueue() : m_refs(1), m_fallback(NULL) {}
         void Update();
+
+        /// called by the delay thread when a query finished
+        void Deliver(MaNGOS::IQueryCallback* callback);
+        /// the owner is destroyed, forward everything to fallback and drop the owner reference
+        void Detach(SqlResultQueue* fallback);
+
+        void AddRef() { ++m_refs; }
+        void Release() { if (--m_refs == 0) delete this; }
+
+    private:
+        ~SqlResultQueue();
+
+        ACE_Atomic_Op<ACE_Thread_Mutex, long> m_refs;
+        ACE_Thread_Mutex m_fallbackLock;
+        SqlResultQueue* m_fallback;                         ///< Set once the owner detached
+};
+
+/**
+ * Routes the callbacks of async queries issued by the current thread on one
+ * database to an owner queue instead of the default queue of that database,
+ * while in scope. Queries on other databases are not affected.
+ */
+class SqlResultQueueScope
+{
+    public:
+        SqlResultQueueScope(Database& db, SqlResultQueue* queue);
+        ~SqlResultQueueScope();
+
+    private:
+        Database& m_db;
+        SqlResultQueue* m_previous;
 };
 
 class SqlQuery : public SqlOperation
 {
     private:
-        const char* m_sql;
+        SqlOperationText m_sql;
         MaNGOS::IQueryCallback* m_callback;
         SqlResultQueue* m_queue;
     public:
         SqlQuery(const char* sql, MaNGOS::IQueryCallback* callback, SqlResultQueue* queue)
-            : m_sql(mangos_strdup(sql)), m_callback(callback), m_queue(queue) {}
-        ~SqlQuery() { char* tofree = const_cast<char*>(m_sql); delete[] tofree; }
+            : m_sql(sql), m_callback(callback), m_queue(queue) { if (m_queue) m_queue->AddRef(); }
+        ~SqlQuery() { if (m_queue) m_queue->Release(); }
         bool Execute(SqlConnection* conn) override;
+
+        static void* operator new(size_t size) { return s_pool.Allocate(size); }
+        static void operator delete(void* p, size_t size) { s_pool.Deallocate(p, size); }
+
+    private:
+        static SqlOperationPool<SqlQuery> s_pool;
 };
 
 class SqlQueryHolder
@@ -133,7 +299,8 @@ class SqlQueryHolderEx : public SqlOperation
         SqlResultQueue* m_queue;
     public:
         SqlQueryHolderEx(SqlQueryHolder* holder, MaNGOS::IQueryCallback* callback, SqlResultQueue* queue)
-            : m_holder(holder), m_callback(callback), m_queue(queue) {}
+            : m_holder(holder), m_callback(callback), m_queue(queue) { if (m_queue) m_queue->AddRef(); }
+        ~SqlQueryHolderEx() { if (m_queue) m_queue->Release(); }
         bool Execute(SqlConnection* conn) override;
 };
 #endif                                                      //__SQLOPERATIONS_H
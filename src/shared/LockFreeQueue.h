@@ -0,0 +1,139 @@
+/*
+ * This file is part of the CMaNGOS Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef LOCKFREEQUEUE_H
+#define LOCKFREEQUEUE_H
+
+#include <ace/config-all.h>
+#include <ace/os_include/os_stddef.h>
+
+#if defined(_MSC_VER)
+#  include <windows.h>
+#endif
+
+namespace ACE_Based
+{
+    /// Atomically replace *dest with exchange if it equals comparand, return the previous value (full barrier).
+    inline void* AtomicCompareExchangePointer(void* volatile* dest, void* exchange, void* comparand)
+    {
+#if defined(_MSC_VER)
+        return InterlockedCompareExchangePointer(dest, exchange, comparand);
+#elif defined(__GNUC__)
+        return __sync_val_compare_and_swap(dest, comparand, exchange);
+#else
+#  error "AtomicCompareExchangePointer is not implemented for this compiler"
+#endif
+    }
+
+    /// Atomically replace *dest with exchange, return the previous value (full barrier).
+    inline void* AtomicExchangePointer(void* volatile* dest, void* exchange)
+    {
+        void* old;
+        do
+            old = *dest;
+        while (AtomicCompareExchangePointer(dest, exchange, old) != old);
+        return old;
+    }
+
+    /**
+     * Intrusive lock free stack, nodes are linked through the T::*Next member.
+     *
+     * Any thread may push, the content is only ever taken as a whole by take_all(),
+     * so there is no single pop and no ABA problem.
+     */
+    template <class T, T* T::*Next>
+    class LockFreeStack
+    {
+        public:
+            LockFreeStack() : _head(NULL) {}
+
+            //! Pushes a chain of nodes already linked from first to last.
+            void push(T* first, T* last)
+            {
+                void* old;
+                do
+                {
+                    old = _head;
+                    last->*Next = static_cast<T*>(old);
+                }
+                while (AtomicCompareExchangePointer(&_head, first, old) != old);
+            }
+
+            void push(T* node) { push(node, node); }
+
+            //! Takes all nodes, the most recently pushed first.
+            T* take_all()
+            {
+                if (!_head)
+                    return NULL;
+
+                return static_cast<T*>(AtomicExchangePointer(&_head, NULL));
+            }
+
+            bool empty() const { return _head == NULL; }
+
+        private:
+            void* volatile _head;
+    };
+
+    /**
+     * Intrusive lock free multi-producer single-consumer queue.
+     *
+     * Producers push to a LockFreeStack, the consumer takes the stack as a whole
+     * and reverses it into its private list to return the items in FIFO order.
+     * next() must only be called from one thread at a time.
+     */
+    template <class T, T* T::*Next>
+    class LockFreeQueue
+    {
+        public:
+            LockFreeQueue() : _out(NULL) {}
+
+            //! Adds an item to the queue, from any thread.
+            void add(T* item) { _in.push(item); }
+
+            //! Gets the next item in the queue, if any. Consumer thread only.
+            bool next(T*& result)
+            {
+                if (!_out)
+                {
+                    T* node = _in.take_all();
+                    while (node)
+                    {
+                        T* nextNode = node->*Next;
+                        node->*Next = _out;
+                        _out = node;
+                        node = nextNode;
+                    }
+
+                    if (!_out)
+                        return false;
+                }
+
+                result = _out;
+                _out = _out->*Next;
+                result->*Next = NULL;
+                return true;
+            }
+
+        private:
+            LockFreeStack<T, Next> _in;
+            T* _out;
+    };
+}
+#endif
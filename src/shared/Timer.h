@@ -129,6 +129,33 @@ struct TimeTracker
         time_t i_expiryTime;
 };
 
+/// Count, total and longest duration of a repeated operation, in ms
+struct UpdateTimeStats
+{
+    public:
+        UpdateTimeStats() : count(0), totalTime(0), maxTime(0) {}
+
+        void Add(uint32 time)
+        {
+            ++count;
+            totalTime += time;
+            if (time > maxTime)
+                maxTime = time;
+        }
+
+        /// Return the collected values and start over
+        UpdateTimeStats Collect()
+        {
+            UpdateTimeStats stats = *this;
+            *this = UpdateTimeStats();
+            return stats;
+        }
+
+        uint32 count;
+        uint32 totalTime;
+        uint32 maxTime;
+};
+
 struct ShortTimeTracker
 {
     public:
@@ -20,12 +20,94 @@
 #include "Timer.h"
 
 #include "utf8cpp/utf8.h"
-#include "mersennetwister/MersenneTwister.h"
 #include <ace/TSS_T.h>
 #include <ace/INET_Addr.h>
+#include <ace/Atomic_Op.h>
 
-typedef ACE_TSS<MTRand> MTRandTSS;
-static MTRandTSS mtRand;
+/// xoshiro128** generator, one per thread; a few shifts and rotations per number instead of a twister state walk
+class RandomGenerator
+{
+    public:
+        RandomGenerator()
+        {
+            static ACE_Atomic_Op<ACE_Thread_Mutex, long> instances;
+
+            // splitmix64 spreads time and instance number over the whole state, never all zero
+            ACE_Time_Value now = ACE_OS::gettimeofday();
+            uint64 seed = uint64(now.sec()) * 1000000 + now.usec() + uint64(++instances) * UI64LIT(0x9E3779B97F4A7C15);
+            for (int i = 0; i < 4; i += 2)
+            {
+                seed += UI64LIT(0x9E3779B97F4A7C15);
+                uint64 z = seed;
+                z = (z ^ (z >> 30)) * UI64LIT(0xBF58476D1CE4E5B9);
+                z = (z ^ (z >> 27)) * UI64LIT(0x94D049BB133111EB);
+                z ^= z >> 31;
+                m_state[i] = uint32(z);
+                m_state[i + 1] = uint32(z >> 32);
+            }
+        }
+
+        uint32 Next()
+        {
+            uint32 result = Rotl(m_state[1] * 5, 7) * 9;
+            uint32 t = m_state[1] << 9;
+
+            m_state[2] ^= m_state[0];
+            m_state[3] ^= m_state[1];
+            m_state[1] ^= m_state[2];
+            m_state[0] ^= m_state[3];
+            m_state[2] ^= t;
+            m_state[3] = Rotl(m_state[3], 11);
+
+            return result;
+        }
+
+        /// uniform in 0..n (inclusive), without modulo bias
+        uint32 Range(uint32 n)
+        {
+            if (n == 0xFFFFFFFF)
+                return Next();
+
+            uint32 range = n + 1;
+            uint64 m = uint64(Next()) * range;
+            if (uint32(m) < range)
+            {
+                uint32 threshold = (0 - range) % range;
+                while (uint32(m) < threshold)
+                    m = uint64(Next()) * range;
+            }
+            return uint32(m >> 32);
+        }
+
+        /// uniform in [0, 1)
+        double Exc() { return double(Next()) * (1.0 / 4294967296.0); }
+
+    private:
+        static uint32 Rotl(uint32 x, int k) { return (x << k) | (x >> (32 - k)); }
+
+        uint32 m_state[4];
+};
+
+typedef ACE_TSS<RandomGenerator> RandomGeneratorTSS;
+static RandomGeneratorTSS randomGeneratorTSS;
+
+// the TSS object owns the generator, the compiler thread local pointer skips its key lookup
+#if COMPILER == COMPILER_GNU
+static __thread RandomGenerator* randomGenerator = NULL;
+#elif COMPILER == COMPILER_MICROSOFT
+static __declspec(thread) RandomGenerator* randomGenerator = NULL;
+#endif
+
+static inline RandomGenerator& GetRandomGenerator()
+{
+#if COMPILER == COMPILER_GNU || COMPILER == COMPILER_MICROSOFT
+    if (!randomGenerator)
+        randomGenerator = randomGeneratorTSS.operator->();
+    return *randomGenerator;
+#else
+    return *randomGeneratorTSS.operator->();
+#endif
+}
 
 static ACE_Time_Value g_SystemTickTime = ACE_OS::gettimeofday();
 
@@ -70,42 +152,42 @@ uint32 WorldTimer::getMSTime_internal(bool /*savetime*/ /*= false*/)
 //////////////////////////////////////////////////////////////////////////
 int32 irand(int32 min, int32 max)
 {
-    return int32(mtRand->randInt(max - min)) + min;
+    return int32(GetRandomGenerator().Range(uint32(max - min))) + min;
 }
 
 uint32 urand(uint32 min, uint32 max)
 {
-    return mtRand->randInt(max - min) + min;
+    return GetRandomGenerator().Range(max - min) + min;
 }
 
 float frand(float min, float max)
 {
-    return mtRand->randExc(max - min) + min;
+    return float(GetRandomGenerator().Exc() * (max - min)) + min;
 }
 
 int32 rand32()
 {
-    return mtRand->randInt();
+    return int32(GetRandomGenerator().Next());
 }
 
 double rand_norm(void)
 {
-    return mtRand->randExc();
+    return GetRandomGenerator().Exc();
 }
 
 float rand_norm_f(void)
 {
-    return (float)mtRand->randExc();
+    return (float)GetRandomGenerator().Exc();
 }
 
 double rand_chance(void)
 {
-    return mtRand->randExc(100.0);
+    return GetRandomGenerator().Exc() * 100.0;
 }
 
 float rand_chance_f(void)
 {
-    return (float)mtRand->randExc(100.0);
+    return (float)(GetRandomGenerator().Exc() * 100.0);
 }
 
 Tokens StrSplit(const std::string& src, const std::string& sep)
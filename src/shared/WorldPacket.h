@@ -37,6 +37,15 @@ class WorldPacket : public ByteBuffer
         WorldPacket(const WorldPacket& packet)              : ByteBuffer(packet), m_opcode(packet.m_opcode)
         {
         }
+        // copy assignment
+        WorldPacket& operator=(const WorldPacket& packet)
+        {
+            ByteBuffer::operator=(packet);
+            m_opcode = packet.m_opcode;
+            return *this;
+        }
+        // received packets may be pre-decoded subclasses, see MovementPacket
+        virtual ~WorldPacket() {}
 
         void Initialize(Opcodes opcode, size_t newres = 200)
         {